@@ -0,0 +1,189 @@
+#include "MHGUQuestEditor.h"
+
+#include <QCommandLineParser>
+#include <QElapsedTimer>
+#include <QFile>
+#include <QTextStream>
+#include <QtConcurrent/QtConcurrentRun>
+#include <QtWidgets/QApplication>
+
+#include <filesystem>
+#include <memory>
+#include <numeric>
+#include <span>
+#include <vector>
+
+
+// Drives the editor without showing it and reports how long each step takes
+class EditorBench
+{
+public:
+    explicit EditorBench(int rounds) : rounds(rounds), out(stdout) {}
+
+    // Constructing the main window fills every dropdown from the data bundle, the first round is the cold start
+    void startup()
+    {
+        std::vector<qint64> times;
+        for (int round = 0; round < rounds; round++)
+        {
+            QElapsedTimer timer;
+            timer.start();
+
+            const auto editor = std::make_unique<MHGUQuestEditor>();
+            times.push_back(timer.nsecsElapsed());
+        }
+
+        report("Startup", times);
+    }
+
+    // Binding an already parsed quest arc to the UI, and loadQuestDataIntoUi on its own
+    bool questLoad(const QString& path)
+    {
+        MHGUQuestEditor editor;
+        std::vector<qint64> bindTimes;
+        std::vector<qint64> questDataTimes;
+
+        for (int round = 0; round < rounds; round++)
+        {
+            // Parsing runs on a worker thread in the editor as well and is not part of the measurement
+            auto future = QtConcurrent::run(&Resources::QuestSnapshot::load, std::filesystem::path(path.toStdWString()));
+            future.waitForFinished();
+            if (future.resultCount() == 0)
+            {
+                qCritical("Failed to load %s", qUtf8Printable(path));
+                return false;
+            }
+
+            const auto snapshot = future.result();
+
+            QElapsedTimer timer;
+            timer.start();
+            editor.bindQuestSnapshot(*snapshot);
+            bindTimes.push_back(timer.nsecsElapsed());
+
+            timer.start();
+            editor.loadQuestDataIntoUi();
+            questDataTimes.push_back(timer.nsecsElapsed());
+        }
+
+        report("Quest into UI", bindTimes);
+        report("Quest data into UI", questDataTimes);
+        return true;
+    }
+
+    // setAcEquip shows the first arena quest, every other one is shown through loadQuestData like
+    // selecting it in the list would
+    bool acEquipLoad(const QString& path)
+    {
+        const auto acEquip = loadAcEquip(path);
+        if (!acEquip)
+            return false;
+
+        std::vector<qint64> times;
+        for (int round = 0; round < rounds; round++)
+        {
+            // setAcEquip appends to the quest list, so every round starts from a fresh editor
+            AcEquipEditor editor;
+
+            QElapsedTimer timer;
+            timer.start();
+
+            editor.setAcEquip(acEquip);
+            for (int i = 1; i < (int)acEquip->Quests.size(); i++)
+                editor.loadQuestData(i);
+
+            times.push_back(timer.nsecsElapsed());
+        }
+
+        out << QString("%1 arena quests\n").arg(acEquip->Quests.size());
+        report("Arena quests into UI", times);
+        return true;
+    }
+
+private:
+    // Either an ac_pl_equip file or an arc holding one, the same as the editor opens
+    static std::shared_ptr<Resources::AcEquip> loadAcEquip(const QString& path)
+    {
+        std::shared_ptr<Resources::AcEquip> acEquip;
+        if (path.endsWith(".arc"))
+        {
+            const Resources::Arc arc(path.toStdWString());
+            const auto entry = arc.findEntry(uR"(quest\ac_equip\ac_pl_equip)");
+            if (entry)
+                acEquip = Resources::AcEquip::deserialize(arc.getDataView(*entry));
+        }
+        else
+        {
+            QFile file(path);
+            if (file.open(QIODevice::ReadOnly))
+                acEquip = Resources::AcEquip::deserialize(file.readAll());
+        }
+
+        if (!acEquip || acEquip->Quests.empty())
+        {
+            qCritical("Failed to load arena quests from %s", qUtf8Printable(path));
+            return nullptr;
+        }
+
+        return acEquip;
+    }
+
+    void report(const char* name, std::span<const qint64> times)
+    {
+        const auto rest = times.subspan(1);
+        const auto mean = rest.empty() ? 0.0 : std::accumulate(rest.begin(), rest.end(), 0.0) / (double)rest.size();
+
+        out << QString("%1: first %2 ms, then %3 ms on average over %4 rounds\n")
+            .arg(name, -24)
+            .arg(times.front() / 1e6, 8, 'f', 2)
+            .arg(mean / 1e6, 8, 'f', 2)
+            .arg(rest.size());
+        out.flush();
+    }
+
+    int rounds;
+    QTextStream out;
+};
+
+int main(int argc, char* argv[])
+{
+    // Nothing is ever shown, so no display is needed
+    if (!qEnvironmentVariableIsSet("QT_QPA_PLATFORM"))
+        qputenv("QT_QPA_PLATFORM", "offscreen");
+
+    QApplication app(argc, argv);
+    QCoreApplication::setApplicationName("MHGUQuestEditorBench");
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Times editor startup and loading quests into the UI without showing the editor.");
+    parser.addHelpOption();
+
+    const QCommandLineOption roundsOption("rounds", "How often every step is repeated.", "count", "10");
+    parser.addOption(roundsOption);
+
+    const QCommandLineOption questOption("quest", "Quest arc to load into the UI.", "arc");
+    parser.addOption(questOption);
+
+    const QCommandLineOption acEquipOption("ac-equip", "Arena equipment file or arc to load into the arena quest editor.", "file");
+    parser.addOption(acEquipOption);
+    parser.process(app);
+
+    bool ok = false;
+    const auto rounds = parser.value(roundsOption).toInt(&ok);
+    if (!ok || rounds < 1)
+    {
+        qCritical("Invalid round count %s", qUtf8Printable(parser.value(roundsOption)));
+        return 1;
+    }
+
+    EditorBench bench(rounds);
+    bench.startup();
+
+    if (parser.isSet(questOption) && !bench.questLoad(parser.value(questOption)))
+        return 1;
+
+    if (parser.isSet(acEquipOption) && !bench.acEquipLoad(parser.value(acEquipOption)))
+        return 1;
+
+    return 0;
+}
@@ -1,21 +1,28 @@
 #include "MHGUQuestEditor.h"
 
+#include <algorithm>
 #include <ranges>
 #include <regex>
 
 #include <QFileDialog>
-#include <QJsonArray>
-#include <QJsonDocument>
-#include <QJsonObject>
+#include <QHeaderView>
+#include <QMenu>
 #include <QDragEnterEvent>
 #include <QMimeData>
 #include <QMessageBox>
+#include <QProgressBar>
 #include <QSettings>
 #include <QRandomGenerator>
+#include <QtConcurrent/QtConcurrentRun>
 
 #include "SettingsDialog.h"
+#include "Models/ItemDelegates.h"
+#include "Models/RewardTableModel.h"
 #include "Resources/Arc.h"
+#include "Resources/DataBundle.h"
 #include "Resources/QuestData.h"
+#include "Resources/QuestListSync.h"
+#include "Resources/QuestSnapshot.h"
 #include "Resources/StatTable.h"
 #include "Resources/BossSet.h"
 #include "Monster/Id.h"
@@ -26,15 +33,238 @@ template<typename T> concept Enum = std::is_enum_v<T>;
 template<typename T> concept Integral = std::is_integral_v<T>;
 template<typename T> concept AnyIntegral = Integral<T> || Enum<T>;
 
+namespace
+{
+
+// Loaders for the startup data, these run on worker threads and must not touch any widgets
+
+Resources::StatTable loadStatTable()
+{
+    QFile file(":/res/em_nando_tbl.nan");
+    if (!file.open(QIODevice::ReadOnly))
+    {
+        qFatal("Failed to open em_nando_tbl.nan");
+    }
+
+    return Resources::StatTable::deserialize(file.readAll());
+}
+
+// Item ids are indices into the item list
+std::vector<LookupModel::Entry> loadItemNames()
+{
+    const auto names = Resources::DataBundle::builtin().table("item_names");
+
+    std::vector<LookupModel::Entry> itemNames;
+    itemNames.reserve(names.rows());
+    for (u32 i = 0; i < names.rows(); i++)
+    {
+        itemNames.push_back({ names.text(i, 0), (int)i });
+    }
+
+    return itemNames;
+}
+
+// Binding tables of the widgets that repeat per language, rem or large monster.
+// They point at members of the generated Ui class, so nothing is looked up by name at runtime.
+
+using UiClass = Ui::MHGUQuestEditorClass;
+template<typename T> using UiMember = T* UiClass::*;
+
+struct QuestTextBinding
+{
+    UiMember<QLineEdit> Name;
+    UiMember<QLineEdit> Client;
+    UiMember<QPlainTextEdit> Description;
+    UiMember<QPlainTextEdit> Zako;
+    UiMember<QPlainTextEdit> Objective;
+    UiMember<QPlainTextEdit> Failure;
+    UiMember<QLineEdit> Subquest;
+};
+
+struct RemFlagBinding
+{
+    UiMember<QSpinBox> Flags[8];
+    UiMember<QSpinBox> Values[8];
+};
+
+struct MonsterBinding
+{
+    UiMember<QComboBox> Monster;
+    UiMember<QComboBox> Health;
+    UiMember<QComboBox> Attack;
+    UiMember<QComboBox> Defense;
+    UiMember<QComboBox> Other;
+    UiMember<QSpinBox> Special;
+    UiMember<QSpinBox> State;
+    UiMember<QSpinBox> RestoreAmount;
+    UiMember<QSpinBox> Difficulty;
+    UiMember<QSpinBox> Size;
+    UiMember<QSpinBox> SizeTable;
+    UiMember<QSpinBox> StaminaTable;
+    UiMember<QSpinBox> SpawnType;
+    UiMember<QSpinBox> SpawnTargetType;
+    UiMember<QSpinBox> SpawnTargetAmount;
+    UiMember<QLabel> Hp;
+};
+
+// In Language order
+constexpr QuestTextBinding QuestTextBindings[] = {
+    { &UiClass::textNameEng, &UiClass::textClientEng, &UiClass::textDescriptionEng, &UiClass::textZakoEng,
+        &UiClass::textObjectiveEng, &UiClass::textFailureEng, &UiClass::textSubquestEng },
+    { &UiClass::textNameFre, &UiClass::textClientFre, &UiClass::textDescriptionFre, &UiClass::textZakoFre,
+        &UiClass::textObjectiveFre, &UiClass::textFailureFre, &UiClass::textSubquestFre },
+    { &UiClass::textNameGer, &UiClass::textClientGer, &UiClass::textDescriptionGer, &UiClass::textZakoGer,
+        &UiClass::textObjectiveGer, &UiClass::textFailureGer, &UiClass::textSubquestGer },
+    { &UiClass::textNameIta, &UiClass::textClientIta, &UiClass::textDescriptionIta, &UiClass::textZakoIta,
+        &UiClass::textObjectiveIta, &UiClass::textFailureIta, &UiClass::textSubquestIta },
+    { &UiClass::textNameSpa, &UiClass::textClientSpa, &UiClass::textDescriptionSpa, &UiClass::textZakoSpa,
+        &UiClass::textObjectiveSpa, &UiClass::textFailureSpa, &UiClass::textSubquestSpa },
+    { &UiClass::textNameChT, &UiClass::textClientChT, &UiClass::textDescriptionChT, &UiClass::textZakoChT,
+        &UiClass::textObjectiveChT, &UiClass::textFailureChT, &UiClass::textSubquestChT },
+    { &UiClass::textNameChS, &UiClass::textClientChS, &UiClass::textDescriptionChS, &UiClass::textZakoChS,
+        &UiClass::textObjectiveChS, &UiClass::textFailureChS, &UiClass::textSubquestChS },
+};
+
+// MainA, MainB, ExtraA, ExtraB, Sub, same as the reward tabs
+constexpr RemFlagBinding RemFlagBindings[] = {
+    {
+        { &UiClass::spinBoxRemMainAFlag0, &UiClass::spinBoxRemMainAFlag1, &UiClass::spinBoxRemMainAFlag2, &UiClass::spinBoxRemMainAFlag3,
+            &UiClass::spinBoxRemMainAFlag4, &UiClass::spinBoxRemMainAFlag5, &UiClass::spinBoxRemMainAFlag6, &UiClass::spinBoxRemMainAFlag7 },
+        { &UiClass::spinBoxRemMainAValue0, &UiClass::spinBoxRemMainAValue1, &UiClass::spinBoxRemMainAValue2, &UiClass::spinBoxRemMainAValue3,
+            &UiClass::spinBoxRemMainAValue4, &UiClass::spinBoxRemMainAValue5, &UiClass::spinBoxRemMainAValue6, &UiClass::spinBoxRemMainAValue7 }
+    },
+    {
+        { &UiClass::spinBoxRemMainBFlag0, &UiClass::spinBoxRemMainBFlag1, &UiClass::spinBoxRemMainBFlag2, &UiClass::spinBoxRemMainBFlag3,
+            &UiClass::spinBoxRemMainBFlag4, &UiClass::spinBoxRemMainBFlag5, &UiClass::spinBoxRemMainBFlag6, &UiClass::spinBoxRemMainBFlag7 },
+        { &UiClass::spinBoxRemMainBValue0, &UiClass::spinBoxRemMainBValue1, &UiClass::spinBoxRemMainBValue2, &UiClass::spinBoxRemMainBValue3,
+            &UiClass::spinBoxRemMainBValue4, &UiClass::spinBoxRemMainBValue5, &UiClass::spinBoxRemMainBValue6, &UiClass::spinBoxRemMainBValue7 }
+    },
+    {
+        { &UiClass::spinBoxRemExtraAFlag0, &UiClass::spinBoxRemExtraAFlag1, &UiClass::spinBoxRemExtraAFlag2, &UiClass::spinBoxRemExtraAFlag3,
+            &UiClass::spinBoxRemExtraAFlag4, &UiClass::spinBoxRemExtraAFlag5, &UiClass::spinBoxRemExtraAFlag6, &UiClass::spinBoxRemExtraAFlag7 },
+        { &UiClass::spinBoxRemExtraAValue0, &UiClass::spinBoxRemExtraAValue1, &UiClass::spinBoxRemExtraAValue2, &UiClass::spinBoxRemExtraAValue3,
+            &UiClass::spinBoxRemExtraAValue4, &UiClass::spinBoxRemExtraAValue5, &UiClass::spinBoxRemExtraAValue6, &UiClass::spinBoxRemExtraAValue7 }
+    },
+    {
+        { &UiClass::spinBoxRemExtraBFlag0, &UiClass::spinBoxRemExtraBFlag1, &UiClass::spinBoxRemExtraBFlag2, &UiClass::spinBoxRemExtraBFlag3,
+            &UiClass::spinBoxRemExtraBFlag4, &UiClass::spinBoxRemExtraBFlag5, &UiClass::spinBoxRemExtraBFlag6, &UiClass::spinBoxRemExtraBFlag7 },
+        { &UiClass::spinBoxRemExtraBValue0, &UiClass::spinBoxRemExtraBValue1, &UiClass::spinBoxRemExtraBValue2, &UiClass::spinBoxRemExtraBValue3,
+            &UiClass::spinBoxRemExtraBValue4, &UiClass::spinBoxRemExtraBValue5, &UiClass::spinBoxRemExtraBValue6, &UiClass::spinBoxRemExtraBValue7 }
+    },
+    {
+        { &UiClass::spinBoxRemSubFlag0, &UiClass::spinBoxRemSubFlag1, &UiClass::spinBoxRemSubFlag2, &UiClass::spinBoxRemSubFlag3,
+            &UiClass::spinBoxRemSubFlag4, &UiClass::spinBoxRemSubFlag5, &UiClass::spinBoxRemSubFlag6, &UiClass::spinBoxRemSubFlag7 },
+        { &UiClass::spinBoxRemSubValue0, &UiClass::spinBoxRemSubValue1, &UiClass::spinBoxRemSubValue2, &UiClass::spinBoxRemSubValue3,
+            &UiClass::spinBoxRemSubValue4, &UiClass::spinBoxRemSubValue5, &UiClass::spinBoxRemSubValue6, &UiClass::spinBoxRemSubValue7 }
+    },
+};
+
+constexpr MonsterBinding MonsterBindings[] = {
+    {
+        &UiClass::comboMonster1, &UiClass::comboMonster1Health, &UiClass::comboMonster1Attack, &UiClass::comboMonster1Defense, &UiClass::comboMonster1Other,
+        &UiClass::spinBoxMonster1Special, &UiClass::spinBoxMonster1State, &UiClass::spinBoxMonster1RestoreAmount, &UiClass::spinBoxMonster1Difficulty,
+        &UiClass::spinBoxMonster1Size, &UiClass::spinBoxMonster1SizeTable, &UiClass::spinBoxMonster1StaminaTable,
+        &UiClass::spinBoxMonster1SpawnType, &UiClass::spinBoxMonster1SpawnTargetType, &UiClass::spinBoxMonster1SpawnTargetAmount,
+        &UiClass::labelMonster1Hp
+    },
+    {
+        &UiClass::comboMonster2, &UiClass::comboMonster2Health, &UiClass::comboMonster2Attack, &UiClass::comboMonster2Defense, &UiClass::comboMonster2Other,
+        &UiClass::spinBoxMonster2Special, &UiClass::spinBoxMonster2State, &UiClass::spinBoxMonster2RestoreAmount, &UiClass::spinBoxMonster2Difficulty,
+        &UiClass::spinBoxMonster2Size, &UiClass::spinBoxMonster2SizeTable, &UiClass::spinBoxMonster2StaminaTable,
+        &UiClass::spinBoxMonster2SpawnType, &UiClass::spinBoxMonster2SpawnTargetType, &UiClass::spinBoxMonster2SpawnTargetAmount,
+        &UiClass::labelMonster2Hp
+    },
+    {
+        &UiClass::comboMonster3, &UiClass::comboMonster3Health, &UiClass::comboMonster3Attack, &UiClass::comboMonster3Defense, &UiClass::comboMonster3Other,
+        &UiClass::spinBoxMonster3Special, &UiClass::spinBoxMonster3State, &UiClass::spinBoxMonster3RestoreAmount, &UiClass::spinBoxMonster3Difficulty,
+        &UiClass::spinBoxMonster3Size, &UiClass::spinBoxMonster3SizeTable, &UiClass::spinBoxMonster3StaminaTable,
+        &UiClass::spinBoxMonster3SpawnType, &UiClass::spinBoxMonster3SpawnTargetType, &UiClass::spinBoxMonster3SpawnTargetAmount,
+        &UiClass::labelMonster3Hp
+    },
+    {
+        &UiClass::comboMonster4, &UiClass::comboMonster4Health, &UiClass::comboMonster4Attack, &UiClass::comboMonster4Defense, &UiClass::comboMonster4Other,
+        &UiClass::spinBoxMonster4Special, &UiClass::spinBoxMonster4State, &UiClass::spinBoxMonster4RestoreAmount, &UiClass::spinBoxMonster4Difficulty,
+        &UiClass::spinBoxMonster4Size, &UiClass::spinBoxMonster4SizeTable, &UiClass::spinBoxMonster4StaminaTable,
+        &UiClass::spinBoxMonster4SpawnType, &UiClass::spinBoxMonster4SpawnTargetType, &UiClass::spinBoxMonster4SpawnTargetAmount,
+        &UiClass::labelMonster4Hp
+    },
+    {
+        &UiClass::comboMonster5, &UiClass::comboMonster5Health, &UiClass::comboMonster5Attack, &UiClass::comboMonster5Defense, &UiClass::comboMonster5Other,
+        &UiClass::spinBoxMonster5Special, &UiClass::spinBoxMonster5State, &UiClass::spinBoxMonster5RestoreAmount, &UiClass::spinBoxMonster5Difficulty,
+        &UiClass::spinBoxMonster5Size, &UiClass::spinBoxMonster5SizeTable, &UiClass::spinBoxMonster5StaminaTable,
+        &UiClass::spinBoxMonster5SpawnType, &UiClass::spinBoxMonster5SpawnTargetType, &UiClass::spinBoxMonster5SpawnTargetAmount,
+        &UiClass::labelMonster5Hp
+    },
+};
+
+static_assert(std::size(QuestTextBindings) == Resources::Language::Count);
+
+// Quest data fields edited with a plain spin box, by their path in Resources::QuestDataFields
+struct QuestFieldBinding
+{
+    UiMember<QSpinBox> SpinBox;
+    const char* Field;
+};
+
+constexpr QuestFieldBinding QuestFieldBindings[] = {
+    { &UiClass::spinBoxQuestId, "Id" },
+    { &UiClass::spinBoxTimeLimit, "QuestTime" },
+    { &UiClass::spinBoxFaints, "Faints" },
+    { &UiClass::spinBoxArenaEquipId, "ArenaEquipId" },
+    { &UiClass::spinBoxQuestZenny, "Reward" },
+    { &UiClass::spinBoxSubquestZenny, "SubReward" },
+    { &UiClass::spinBoxQuestPoints, "ClearVillagePoints" },
+    { &UiClass::spinBoxSubquestPoints, "SubVillagePoints" },
+    { &UiClass::spinBoxQuestHrp, "HunterRankPoints" },
+    { &UiClass::spinBoxSubquestHrp, "SubHunterRankPoints" },
+    { &UiClass::spinBoxObjective1Amount, "ClearConditions[0].Count" },
+    { &UiClass::spinBoxObjective2Amount, "ClearConditions[1].Count" },
+    { &UiClass::spinBoxSubObjectiveAmount, "SubClearCondition.Count" },
+    { &UiClass::spinBoxSuppliesALabel, "Supplies[0].SuppLabel" },
+    { &UiClass::spinBoxSuppliesAType, "Supplies[0].SuppType" },
+    { &UiClass::spinBoxSuppliesATarget, "Supplies[0].SuppTarget" },
+    { &UiClass::spinBoxSuppliesATargetAmount, "Supplies[0].SuppTargetCount" },
+    { &UiClass::spinBoxSuppliesBLabel, "Supplies[1].SuppLabel" },
+    { &UiClass::spinBoxSuppliesBType, "Supplies[1].SuppType" },
+    { &UiClass::spinBoxSuppliesBTarget, "Supplies[1].SuppTarget" },
+    { &UiClass::spinBoxSuppliesBTargetAmount, "Supplies[1].SuppTargetCount" },
+    { &UiClass::spinBoxRewardBoxes1, "RemAddFrame[0]" },
+    { &UiClass::spinBoxRewardBoxes2, "RemAddFrame[1]" },
+    { &UiClass::spinBoxMaxExtraBoxes, "RemAddLotMax" },
+    { &UiClass::spinBoxMonster2SetType, "EnemySet2.SetType" },
+    { &UiClass::spinBoxMonster2SetTargetId, "EnemySet2.TargetId" },
+    { &UiClass::spinBoxMonster2SetTargetAmount, "EnemySet2.TargetCount" },
+    { &UiClass::spinBoxMonster3SetType, "EnemySet3.SetType" },
+    { &UiClass::spinBoxMonster3SetTargetId, "EnemySet3.TargetId" },
+    { &UiClass::spinBoxMonster3SetTargetAmount, "EnemySet3.TargetCount" },
+    { &UiClass::spinBoxStrayRandom, "StrayRand" },
+    { &UiClass::spinBoxStrayStart, "StrayStartTime" },
+    { &UiClass::spinBoxStrayStartRandom, "StrayStartRand" },
+    { &UiClass::spinBoxStrayLimit3, "StrayLimit345[0]" },
+    { &UiClass::spinBoxStrayLimit4, "StrayLimit345[1]" },
+    { &UiClass::spinBoxStrayLimit5, "StrayLimit345[2]" },
+    { &UiClass::spinBoxStrayRandom3, "StrayRand345[0]" },
+    { &UiClass::spinBoxStrayRandom4, "StrayRand345[1]" },
+    { &UiClass::spinBoxStrayRandom5, "StrayRand345[2]" },
+    { &UiClass::spinBoxExtraTicketCount, "ExtraTicketCount" },
+};
+
+}
+
 MHGUQuestEditor::MHGUQuestEditor(QWidget *parent) : QMainWindow(parent)
 {
     ui.setupUi(this);
+    bindWidgets();
     setAcceptDrops(true);
     setWindowIcon(QIcon(":/res/icon.png"));
 
+    // Data that does not touch any widgets is prepared on worker threads while the
+    // cheaper dropdowns are filled in, only the hookup happens on the UI thread
+    auto monsterIconsFuture = QtConcurrent::run(&IconAtlas::load);
+    auto statTableFuture = QtConcurrent::run(&loadStatTable);
+    auto itemNamesFuture = QtConcurrent::run(&loadItemNames);
+
     // Initialize dropdowns
-    initIconDropdowns();
-    initStatDropdowns();
     initMonsterDropdowns();
     initQuestTypeDropdown();
     initQuestSubTypeDropdown();
@@ -47,8 +277,11 @@ MHGUQuestEditor::MHGUQuestEditor(QWidget *parent) : QMainWindow(parent)
     initClearTypeDropdown();
     initObjectiveDropdowns();
     initItemLevelDropdowns();
-    initItemNames();
     initSpawns();
+    initStatDropdowns(statTableFuture.result());
+    initIconDropdowns(monsterIconsFuture.result());
+    initItemNames(itemNamesFuture.result());
+    initRewardTables();
 
     loadSettings();
 
@@ -67,37 +300,36 @@ This operation cannot be undone. Do you want to continue?)", QMessageBox::Yes |
 
         if (button == QMessageBox::Yes)
         {
-            using Resources::Language;
             const auto currentLang = ui.tabWidgetLanguage->currentIndex();
-            const auto currentLangString = Language::toString(currentLang, true);
-
-            const auto currentWidget = ui.tabWidgetLanguage->currentWidget();
-            const auto currentName = currentWidget->findChild<QLineEdit*>("textName" + currentLangString)->text();
-            const auto currentClient = currentWidget->findChild<QLineEdit*>("textClient" + currentLangString)->text();
-            const auto currentDesc = currentWidget->findChild<QPlainTextEdit*>("textDescription" + currentLangString)->toPlainText();
-            const auto currentZako = currentWidget->findChild<QPlainTextEdit*>("textZako" + currentLangString)->toPlainText();
-            const auto currentObjective = currentWidget->findChild<QPlainTextEdit*>("textObjective" + currentLangString)->toPlainText();
-            const auto currentFailure = currentWidget->findChild<QPlainTextEdit*>("textFailure" + currentLangString)->toPlainText();
-            const auto currentSub = currentWidget->findChild<QLineEdit*>("textSubquest" + currentLangString)->text();
-
-            for (auto i = 0; i < Language::Count; i++)
+            const auto& current = questTextWidgets[currentLang];
+
+            const auto currentName = current.Name->text();
+            const auto currentClient = current.Client->text();
+            const auto currentDesc = current.Description->toPlainText();
+            const auto currentZako = current.Zako->toPlainText();
+            const auto currentObjective = current.Objective->toPlainText();
+            const auto currentFailure = current.Failure->toPlainText();
+            const auto currentSub = current.Subquest->text();
+
+            for (auto i = 0; i < questTextWidgets.size(); i++)
             {
                 if (i == currentLang)
                     continue;
 
-                const auto languageString = Language::toString(i, true);
-                const auto widget = ui.tabWidgetLanguage->widget(i);
-                widget->findChild<QLineEdit*>("textName" + languageString)->setText(currentName);
-                widget->findChild<QLineEdit*>("textClient" + languageString)->setText(currentClient);
-                widget->findChild<QPlainTextEdit*>("textDescription" + languageString)->setPlainText(currentDesc);
-                widget->findChild<QPlainTextEdit*>("textZako" + languageString)->setPlainText(currentZako);
-                widget->findChild<QPlainTextEdit*>("textObjective" + languageString)->setPlainText(currentObjective);
-                widget->findChild<QPlainTextEdit*>("textFailure" + languageString)->setPlainText(currentFailure);
-                widget->findChild<QLineEdit*>("textSubquest" + languageString)->setText(currentSub);
+                const auto& widgets = questTextWidgets[i];
+                widgets.Name->setText(currentName);
+                widgets.Client->setText(currentClient);
+                widgets.Description->setPlainText(currentDesc);
+                widgets.Zako->setPlainText(currentZako);
+                widgets.Objective->setPlainText(currentObjective);
+                widgets.Failure->setPlainText(currentFailure);
+                widgets.Subquest->setText(currentSub);
             }
         }
     });
     connect(ui.actionSettings, &QAction::triggered, this, &MHGUQuestEditor::openSettings);
+    connect(ui.actionCompactQuestList, &QAction::triggered, this, &MHGUQuestEditor::compactQuestList);
+    connect(ui.actionSyncQuestFolder, &QAction::triggered, this, &MHGUQuestEditor::syncQuestFolderToQuestList);
     connect(ui.actionSave, &QAction::triggered, this, &MHGUQuestEditor::onSaveFile);
     connect(ui.actionSaveAs, &QAction::triggered, this, &MHGUQuestEditor::onSaveFileAs);
     connect(ui.actionExit, &QAction::triggered, this, &MHGUQuestEditor::close);
@@ -116,11 +348,26 @@ This operation cannot be undone. Do you want to continue?)", QMessageBox::Yes |
             });
         }
     });
-    connect(ui.buttonRemMainAAdd, &QPushButton::pressed, this, [this] { addRemEntry("MainA", 0); });
-    connect(ui.buttonRemMainBAdd, &QPushButton::pressed, this, [this] { addRemEntry("MainB", 1); });
-    connect(ui.buttonRemExtraAAdd, &QPushButton::pressed, this, [this] { addRemEntry("ExtraA", 2); });
-    connect(ui.buttonRemExtraBAdd, &QPushButton::pressed, this, [this] { addRemEntry("ExtraB", 3); });
-    connect(ui.buttonRemSubAdd, &QPushButton::pressed, this, [this] { addRemEntry("Sub", 4); });
+
+    loadProgress = new QProgressBar(ui.statusBar);
+    loadProgress->setMaximumWidth(200);
+    loadProgress->setTextVisible(false);
+    loadProgress->hide();
+    cancelLoadButton = new QPushButton("Cancel", ui.statusBar);
+    cancelLoadButton->hide();
+    ui.statusBar->addPermanentWidget(loadProgress);
+    ui.statusBar->addPermanentWidget(cancelLoadButton);
+
+    connect(cancelLoadButton, &QPushButton::clicked, &questLoadWatcher, &QFutureWatcherBase::cancel);
+    connect(&questLoadWatcher, &QFutureWatcherBase::progressRangeChanged, loadProgress, &QProgressBar::setRange);
+    connect(&questLoadWatcher, &QFutureWatcherBase::progressValueChanged, loadProgress, &QProgressBar::setValue);
+    connect(&questLoadWatcher, &QFutureWatcherBase::finished, this, &MHGUQuestEditor::onQuestArcLoaded);
+
+    connect(ui.buttonRemMainAAdd, &QPushButton::pressed, this, [this] { addRemEntry(0); });
+    connect(ui.buttonRemMainBAdd, &QPushButton::pressed, this, [this] { addRemEntry(1); });
+    connect(ui.buttonRemExtraAAdd, &QPushButton::pressed, this, [this] { addRemEntry(2); });
+    connect(ui.buttonRemExtraBAdd, &QPushButton::pressed, this, [this] { addRemEntry(3); });
+    connect(ui.buttonRemSubAdd, &QPushButton::pressed, this, [this] { addRemEntry(4); });
 
     ui.actionSaveArenaQuests->setEnabled(false);
     ui.tabWidgetRoot->setTabEnabled(1, false); // Quest Info
@@ -173,14 +420,24 @@ This operation cannot be undone. Do you want to continue?)", QMessageBox::Yes |
         widget->setLayout(layout);
     }
 
-    acEquipEditor = new AcEquipEditor(this);
-
-    const auto acEquipWidget = ui.tabWidgetRoot->widget(5);
-    acEquipWidget->layout()->addWidget(acEquipEditor);
+    // The arena equip editor is created by getAcEquipEditor once arena quests are opened
 }
 
 MHGUQuestEditor::~MHGUQuestEditor() = default;
 
+AcEquipEditor* MHGUQuestEditor::getAcEquipEditor()
+{
+    if (!acEquipEditor)
+    {
+        acEquipEditor = new AcEquipEditor(this);
+
+        const auto acEquipWidget = ui.tabWidgetRoot->widget(5);
+        acEquipWidget->layout()->addWidget(acEquipEditor);
+    }
+
+    return acEquipEditor;
+}
+
 void MHGUQuestEditor::dragEnterEvent(QDragEnterEvent* event)
 {
     if (event->mimeData()->hasUrls())
@@ -202,394 +459,249 @@ void MHGUQuestEditor::dropEvent(QDropEvent* event)
 
 void MHGUQuestEditor::closeEvent(QCloseEvent* event)
 {
+    questLoadWatcher.cancel();
     saveSettings();
     event->accept();
 }
 
-void MHGUQuestEditor::initIconDropdowns()
+void MHGUQuestEditor::bindWidgets()
 {
-    const QImage icons(":/res/cmn_micon00.png");
-    constexpr int iconSize = 70;
-    constexpr int offsetX = 1;
-    constexpr int offsetY = 1;
-    constexpr int gap = 2;
+    for (auto i = 0; i < questTextWidgets.size(); ++i)
+    {
+        const auto& binding = QuestTextBindings[i];
+        questTextWidgets[i] = {
+            ui.*binding.Name, ui.*binding.Client,
+            ui.*binding.Description, ui.*binding.Zako,
+            ui.*binding.Objective, ui.*binding.Failure,
+            ui.*binding.Subquest
+        };
+    }
 
-    for (int y = 0; y < 14; y++)
+    for (auto i = 0; i < remFlagWidgets.size(); ++i)
     {
-        for (int x = 0; x < 7; x++)
+        for (auto flag = 0; flag < 8; ++flag)
         {
-            const int xPos = x * (iconSize + gap) + offsetX;
-            const int yPos = y * (iconSize + gap) + offsetY;
-            monsterIcons.emplace_back(QPixmap::fromImage(icons.copy(xPos, yPos, iconSize, iconSize)));
+            remFlagWidgets[i].Flags[flag] = ui.*RemFlagBindings[i].Flags[flag];
+            remFlagWidgets[i].Values[flag] = ui.*RemFlagBindings[i].Values[flag];
         }
     }
 
-    const QImage icons2(":/res/cmn_micon01.png");
-
-    for (int y = 0; y < 14; y++)
+    for (auto i = 0; i < monsterWidgets.size(); ++i)
     {
-        for (int x = 0; x < 7; x++)
-        {
-            const int xPos = x * (iconSize + gap) + offsetX;
-            const int yPos = y * (iconSize + gap) + offsetY;
-            monsterIcons.emplace_back(QPixmap::fromImage(icons2.copy(xPos, yPos, iconSize, iconSize)));
-
-            if (y == 6)
-            {
-                y = 14;
-                break;
-            }
-        }
+        const auto& binding = MonsterBindings[i];
+        monsterWidgets[i] = {
+            ui.*binding.Monster, ui.*binding.Health, ui.*binding.Attack, ui.*binding.Defense, ui.*binding.Other,
+            ui.*binding.Special, ui.*binding.State, ui.*binding.RestoreAmount, ui.*binding.Difficulty,
+            ui.*binding.Size, ui.*binding.SizeTable, ui.*binding.StaminaTable,
+            ui.*binding.SpawnType, ui.*binding.SpawnTargetType, ui.*binding.SpawnTargetAmount,
+            ui.*binding.Hp
+        };
     }
 
-    auto iconNames = QFile(":/res/icon_names.json");
-    if (!iconNames.open(QIODevice::ReadOnly))
+    for (const auto& binding : QuestFieldBindings)
     {
-        qFatal("Failed to open icon_names.json");
+        const auto field = Resources::QuestFieldRef::find(binding.Field);
+        if (!field)
+            qFatal("Quest data has no field %s", binding.Field);
+
+        questFieldWidgets.push_back({ ui.*binding.SpinBox, *field });
     }
+}
 
-    QJsonArray iconNamesArray = QJsonDocument::fromJson(iconNames.readAll()).array();
-    for (int i = 0; i < iconNamesArray.size(); i++)
-    {
-        const auto name = iconNamesArray[i].toString("N/A");
+void MHGUQuestEditor::initIconDropdowns(IconAtlas icons)
+{
+    monsterIcons = std::move(icons);
 
-        if (i == 0 || i >= monsterIcons.size())
-        {
-            ui.comboIcon1->addItem(name);
-            ui.comboIcon2->addItem(name);
-            ui.comboIcon3->addItem(name);
-            ui.comboIcon4->addItem(name);
-            ui.comboIcon5->addItem(name);
-        }
-        else
-        {
-            const auto icon = monsterIcons[i - 1];
-            ui.comboIcon1->addItem(icon, name);
-            ui.comboIcon2->addItem(icon, name);
-            ui.comboIcon3->addItem(icon, name);
-            ui.comboIcon4->addItem(icon, name);
-            ui.comboIcon5->addItem(icon, name);
-        }
+    const auto iconNames = Resources::DataBundle::builtin().table("icon_names");
+    std::vector<LookupModel::Entry> entries;
+    entries.reserve(iconNames.rows());
+    for (int i = 0; i < (int)iconNames.rows(); i++)
+    {
+        const auto hasIcon = i != 0 && i < monsterIcons.size();
+        entries.push_back({ iconNames.text(i, 0), i, hasIcon ? QIcon(monsterIcons.pixmap(i - 1)) : QIcon() });
     }
 
+    const auto iconModel = new LookupModel(std::move(entries), this);
+    ui.comboIcon1->setModel(iconModel);
+    ui.comboIcon2->setModel(iconModel);
+    ui.comboIcon3->setModel(iconModel);
+    ui.comboIcon4->setModel(iconModel);
+    ui.comboIcon5->setModel(iconModel);
+
     connect(ui.comboIcon1, &QComboBox::currentIndexChanged, this, [this](int index) {
         if (index == 0 || index >= monsterIcons.size()) {
             ui.labelIcon1->setPixmap({});
             return;
         }
-        ui.labelIcon1->setPixmap(monsterIcons[index - 1]);
+        ui.labelIcon1->setPixmap(monsterIcons.pixmap(index - 1));
     });
     connect(ui.comboIcon2, &QComboBox::currentIndexChanged, this, [this](int index) {
         if (index == 0 || index >= monsterIcons.size()) {
             ui.labelIcon2->setPixmap({});
             return;
         }
-        ui.labelIcon2->setPixmap(monsterIcons[index - 1]);
+        ui.labelIcon2->setPixmap(monsterIcons.pixmap(index - 1));
     });
     connect(ui.comboIcon3, &QComboBox::currentIndexChanged, this, [this](int index) {
         if (index == 0 || index >= monsterIcons.size()) {
             ui.labelIcon3->setPixmap({});
             return;
         }
-        ui.labelIcon3->setPixmap(monsterIcons[index - 1]);
+        ui.labelIcon3->setPixmap(monsterIcons.pixmap(index - 1));
     });
     connect(ui.comboIcon4, &QComboBox::currentIndexChanged, this, [this](int index) {
         if (index == 0 || index >= monsterIcons.size()) {
             ui.labelIcon4->setPixmap({});
             return;
         }
-        ui.labelIcon4->setPixmap(monsterIcons[index - 1]);
+        ui.labelIcon4->setPixmap(monsterIcons.pixmap(index - 1));
     });
     connect(ui.comboIcon5, &QComboBox::currentIndexChanged, this, [this](int index) {
         if (index == 0 || index >= monsterIcons.size()) {
             ui.labelIcon5->setPixmap({});
             return;
         }
-        ui.labelIcon5->setPixmap(monsterIcons[index - 1]);
+        ui.labelIcon5->setPixmap(monsterIcons.pixmap(index - 1));
     });
 }
 
-void MHGUQuestEditor::initStatDropdowns() {
-    QFile file(":/res/em_nando_tbl.nan");
-    if (!file.open(QIODevice::ReadOnly))
-    {
-        qFatal("Failed to open em_nando_tbl.nan");
-    }
-
-    const Resources::StatTable table = Resources::StatTable::deserialize(file.readAll());
+void MHGUQuestEditor::initStatDropdowns(const Resources::StatTable& table) {
+    std::vector<LookupModel::Entry> health, attack, defense, other;
     for (int i = 0; i < table.size(); i++)
     {
         const auto& entry = table[i];
 
-        const auto health = QString("%1%").arg(entry.Health * 100.0f);
-        const auto attack = QString("%1%").arg(entry.Attack * 100.0f);
-        const auto defense = QString("%1%").arg(entry.Defense * 100.0f);
-        const auto other = QString("Stagger: %1% Exhaust: %1% KO: %1% Mount: %1% Unk: %1%")
+        health.push_back({ QString("%1%").arg(entry.Health * 100.0f), i });
+        attack.push_back({ QString("%1%").arg(entry.Attack * 100.0f), i });
+        defense.push_back({ QString("%1%").arg(entry.Defense * 100.0f), i });
+        other.push_back({ QString("Stagger: %1% Exhaust: %1% KO: %1% Mount: %1% Unk: %1%")
             .arg(entry.Stagger * 100.0f)
             .arg(entry.Exhaust * 100.0f)
             .arg(entry.KO * 100.0f)
             .arg(entry.Mount * 100.0f)
-            .arg(entry.Unknown * 100.0f);
+            .arg(entry.Unknown * 100.0f), i });
 
         monsterHealthMods.push_back(entry.Health);
-
-        ui.comboMonster1Health->addItem(health);
-        ui.comboMonster1Attack->addItem(attack);
-        ui.comboMonster1Defense->addItem(defense);
-        ui.comboMonster1Other->addItem(other);
-
-        ui.comboMonster2Health->addItem(health);
-        ui.comboMonster2Attack->addItem(attack);
-        ui.comboMonster2Defense->addItem(defense);
-        ui.comboMonster2Other->addItem(other);
-
-        ui.comboMonster3Health->addItem(health);
-        ui.comboMonster3Attack->addItem(attack);
-        ui.comboMonster3Defense->addItem(defense);
-        ui.comboMonster3Other->addItem(other);
-
-        ui.comboMonster4Health->addItem(health);
-        ui.comboMonster4Attack->addItem(attack);
-        ui.comboMonster4Defense->addItem(defense);
-        ui.comboMonster4Other->addItem(other);
-
-        ui.comboMonster5Health->addItem(health);
-        ui.comboMonster5Attack->addItem(attack);
-        ui.comboMonster5Defense->addItem(defense);
-        ui.comboMonster5Other->addItem(other);
-
-        ui.comboZakoHealth->addItem(health);
-        ui.comboZakoAttack->addItem(attack);
-        ui.comboZakoOther->addItem(other);
     }
-}
 
-void MHGUQuestEditor::initMonsterDropdowns() {
-    auto monsterNames = QFile(":/res/em_names.json");
-    if (!monsterNames.open(QIODevice::ReadOnly))
-    {
-        qFatal("Failed to open em_names.json");
-    }
+    const auto healthModel = new LookupModel(std::move(health), this);
+    const auto attackModel = new LookupModel(std::move(attack), this);
+    const auto defenseModel = new LookupModel(std::move(defense), this);
+    const auto otherModel = new LookupModel(std::move(other), this);
 
-    QJsonObject names = QJsonDocument::fromJson(monsterNames.readAll()).object();
-    for (const auto& name : names.keys())
+    for (const auto& widgets : monsterWidgets)
     {
-        const auto data = names[name].toObject();
-        const auto id = QVariant(data["Id"].toInt());
-        const auto baseHp = data["BaseHp"].toInt();
-        ui.comboMonster1->addItem(name, id);
-        ui.comboMonster2->addItem(name, id);
-        ui.comboMonster3->addItem(name, id);
-        ui.comboMonster4->addItem(name, id);
-        ui.comboMonster5->addItem(name, id);
-
-        emBaseHp[id.toInt()] = baseHp;
+        widgets.Health->setModel(healthModel);
+        widgets.Attack->setModel(attackModel);
+        widgets.Defense->setModel(defenseModel);
+        widgets.Other->setModel(otherModel);
     }
 
-    const auto updateHp1 = [this](int) {
-        const auto id = ui.comboMonster1->currentData().toInt();
-        const auto modifier = ui.comboMonster1Health->currentIndex();
-        ui.labelMonster1Hp->setText(QString("Actual HP: %1").arg(emBaseHp[id] * monsterHealthMods[modifier]));
-    };
-    const auto updateHp2 = [this](int) {
-        const auto id = ui.comboMonster2->currentData().toInt();
-        const auto modifier = ui.comboMonster2Health->currentIndex();
-        ui.labelMonster2Hp->setText(QString("Actual HP: %1").arg(emBaseHp[id] * monsterHealthMods[modifier]));
-    };
-    const auto updateHp3 = [this](int) {
-        const auto id = ui.comboMonster3->currentData().toInt();
-        const auto modifier = ui.comboMonster3Health->currentIndex();
-        ui.labelMonster3Hp->setText(QString("Actual HP: %1").arg(emBaseHp[id] * monsterHealthMods[modifier]));
-    };
-    const auto updateHp4 = [this](int) {
-        const auto id = ui.comboMonster4->currentData().toInt();
-        const auto modifier = ui.comboMonster4Health->currentIndex();
-        ui.labelMonster4Hp->setText(QString("Actual HP: %1").arg(emBaseHp[id] * monsterHealthMods[modifier]));
-    };
-    const auto updateHp5 = [this](int) {
-        const auto id = ui.comboMonster5->currentData().toInt();
-        const auto modifier = ui.comboMonster5Health->currentIndex();
-        ui.labelMonster5Hp->setText(QString("Actual HP: %1").arg(emBaseHp[id] * monsterHealthMods[modifier]));
-    };
-
-    connect(ui.comboMonster1, &QComboBox::currentIndexChanged, this, updateHp1);
-    connect(ui.comboMonster1Health, &QComboBox::currentIndexChanged, this, updateHp1);
-    connect(ui.comboMonster2, &QComboBox::currentIndexChanged, this, updateHp2);
-    connect(ui.comboMonster2Health, &QComboBox::currentIndexChanged, this, updateHp2);
-    connect(ui.comboMonster3, &QComboBox::currentIndexChanged, this, updateHp3);
-    connect(ui.comboMonster3Health, &QComboBox::currentIndexChanged, this, updateHp3);
-    connect(ui.comboMonster4, &QComboBox::currentIndexChanged, this, updateHp4);
-    connect(ui.comboMonster4Health, &QComboBox::currentIndexChanged, this, updateHp4);
-    connect(ui.comboMonster5, &QComboBox::currentIndexChanged, this, updateHp5);
-    connect(ui.comboMonster5Health, &QComboBox::currentIndexChanged, this, updateHp5);
+    ui.comboZakoHealth->setModel(healthModel);
+    ui.comboZakoAttack->setModel(attackModel);
+    ui.comboZakoOther->setModel(otherModel);
 }
 
-void MHGUQuestEditor::initQuestTypeDropdown() const {
-    auto questTypes = QFile(":/res/quest_type.json");
-    if (!questTypes.open(QIODevice::ReadOnly))
+void MHGUQuestEditor::initMonsterDropdowns() {
+    const auto names = Resources::DataBundle::builtin().table("em_names");
+    for (u32 i = 0; i < names.rows(); i++)
     {
-        qFatal("Failed to open quest_type.json");
+        emBaseHp[names.integer(i, 1)] = names.integer(i, 2);
     }
 
-    QJsonArray types = QJsonDocument::fromJson(questTypes.readAll()).array();
-    for (const auto [i, type] : std::views::enumerate(types))
+    monsterModel = LookupModel::fromTable(names, this);
+    for (const auto& widgets : monsterWidgets)
     {
-        ui.comboQuestType->addItem(type.toString(), i);
-    }
-}
+        widgets.Monster->setModel(monsterModel);
 
-void MHGUQuestEditor::initQuestSubTypeDropdown() const {
-    auto questSubTypes = QFile(":/res/quest_subtype.json");
-    if (!questSubTypes.open(QIODevice::ReadOnly))
-    {
-        qFatal("Failed to open quest_subtype.json");
-    }
+        const auto updateHp = [this, &widgets](int) {
+            const auto id = widgets.Monster->currentData().toInt();
+            const auto modifier = widgets.Health->currentIndex();
+            widgets.Hp->setText(QString("Actual HP: %1").arg(emBaseHp[id] * monsterHealthMods[modifier]));
+        };
 
-    QJsonArray subTypes = QJsonDocument::fromJson(questSubTypes.readAll()).array();
-    for (const auto [i, type] : std::views::enumerate(subTypes))
-    {
-        ui.comboQuestSubType->addItem(type.toString(), i);
+        connect(widgets.Monster, &QComboBox::currentIndexChanged, this, updateHp);
+        connect(widgets.Health, &QComboBox::currentIndexChanged, this, updateHp);
     }
 }
 
-void MHGUQuestEditor::initQuestLevelDropdown() const {
-    auto questLevels = QFile(":/res/quest_level.json");
-    if (!questLevels.open(QIODevice::ReadOnly))
-    {
-        qFatal("Failed to open quest_level.json");
-    }
+void MHGUQuestEditor::initQuestTypeDropdown()
+{
+    ui.comboQuestType->setModel(LookupModel::fromTable(Resources::DataBundle::builtin().table("quest_type"), this));
+}
 
-    QJsonArray levels = QJsonDocument::fromJson(questLevels.readAll()).array();
-    for (const auto level : levels)
-    {
-        const auto obj = level.toObject();
-        ui.comboQuestLevel->addItem(obj["Name"].toString(), obj["Value"].toInt());
-    }
+void MHGUQuestEditor::initQuestSubTypeDropdown()
+{
+    ui.comboQuestSubType->setModel(LookupModel::fromTable(Resources::DataBundle::builtin().table("quest_subtype"), this));
 }
 
-void MHGUQuestEditor::initMonsterLevelDropdown() const
+void MHGUQuestEditor::initQuestLevelDropdown()
 {
-    auto monsterLevels = QFile(":/res/em_level.json");
-    if (!monsterLevels.open(QIODevice::ReadOnly))
-    {
-        qFatal("Failed to open monster_level.json");
-    }
+    ui.comboQuestLevel->setModel(LookupModel::fromTable(Resources::DataBundle::builtin().table("quest_level"), this));
+}
 
-    QJsonArray levels = QJsonDocument::fromJson(monsterLevels.readAll()).array();
-    for (const auto level : levels)
-    {
-        const auto obj = level.toObject();
-        ui.comboMonsterLevel->addItem(obj["Name"].toString(), obj["Value"].toInt());
-    }
+void MHGUQuestEditor::initMonsterLevelDropdown()
+{
+    ui.comboMonsterLevel->setModel(LookupModel::fromTable(Resources::DataBundle::builtin().table("em_level"), this));
 }
 
 void MHGUQuestEditor::initMapDropdown()
 {
-    auto mapsFile = QFile(":/res/map_names.json");
-    if (!mapsFile.open(QIODevice::ReadOnly))
-    {
-        qFatal("Failed to open map_names.json");
-    }
-
-    QJsonArray maps = QJsonDocument::fromJson(mapsFile.readAll()).array();
-    for (const auto map : maps)
-    {
-        const auto obj = map.toObject();
-        const auto name = obj["Name"].toString();
-        const auto value = obj["Value"].toInt();
-        ui.comboMap->addItem(name, value);
+    const auto maps = Resources::DataBundle::builtin().table("map_names");
+    std::vector<LookupModel::Entry> entries;
+    entries.reserve(maps.rows());
+    for (u32 i = 0; i < maps.rows(); i++)
+    {
+        const auto name = maps.text(i, 0);
+        const auto value = maps.integer(i, 1);
+        entries.push_back({ name, value });
         mapNames[value] = name;
     }
 
-    ui.comboMap->model()->sort(0);
+    std::ranges::sort(entries, {}, &LookupModel::Entry::Name);
+    ui.comboMap->setModel(new LookupModel(std::move(entries), this));
 }
 
-void MHGUQuestEditor::initSpawnTypeDropdown() const {
-    auto spawnTypes = QFile(":/res/quest_start_type.json");
-    if (!spawnTypes.open(QIODevice::ReadOnly))
-    {
-        qFatal("Failed to open spawn_types.json");
-    }
-
-    QJsonArray types = QJsonDocument::fromJson(spawnTypes.readAll()).array();
-    for (const auto [i, type] : std::views::enumerate(types))
-    {
-        ui.comboSpawnType->addItem(type.toString(), i);
-    }
+void MHGUQuestEditor::initSpawnTypeDropdown()
+{
+    ui.comboSpawnType->setModel(LookupModel::fromTable(Resources::DataBundle::builtin().table("quest_start_type"), this));
 }
 
-void MHGUQuestEditor::initBgmDropdown() const {
-    auto questBgm = QFile(":/res/quest_bgm.json");
-    if (!questBgm.open(QIODevice::ReadOnly))
-    {
-        qFatal("Failed to open bgm.json");
-    }
-
-    QJsonArray bgms = QJsonDocument::fromJson(questBgm.readAll()).array();
-    for (const auto [i, bgm] : std::views::enumerate(bgms))
-    {
-        ui.comboBgm->addItem(bgm.toString(), i);
-    }
+void MHGUQuestEditor::initBgmDropdown()
+{
+    ui.comboBgm->setModel(LookupModel::fromTable(Resources::DataBundle::builtin().table("quest_bgm"), this));
 }
 
-void MHGUQuestEditor::initRequirementsDropdowns() const {
-    auto questRequirements = QFile(":/res/quest_requirement.json");
-    if (!questRequirements.open(QIODevice::ReadOnly))
-    {
-        qFatal("Failed to open quest_requirement.json");
-    }
-
-    QJsonArray requirements = QJsonDocument::fromJson(questRequirements.readAll()).array();
-    for (const auto [i, requirement] : std::views::enumerate(requirements))
-    {
-        ui.comboRequirement1->addItem(requirement.toString(), i);
-        ui.comboRequirement2->addItem(requirement.toString(), i);
-        ui.comboComboRequirement->addItem(requirement.toString(), i);
-    }
+void MHGUQuestEditor::initRequirementsDropdowns()
+{
+    const auto model = LookupModel::fromTable(Resources::DataBundle::builtin().table("quest_requirement"), this);
+    ui.comboRequirement1->setModel(model);
+    ui.comboRequirement2->setModel(model);
+    ui.comboComboRequirement->setModel(model);
 }
 
-void MHGUQuestEditor::initClearTypeDropdown() const {
-    auto questClearTypes = QFile(":/res/quest_clear_type.json");
-    if (!questClearTypes.open(QIODevice::ReadOnly))
-    {
-        qFatal("Failed to open quest_clear_type.json");
-    }
-
-    QJsonArray clearTypes = QJsonDocument::fromJson(questClearTypes.readAll()).array();
-    for (const auto [i, clearType] : std::views::enumerate(clearTypes))
-    {
-        ui.comboClearType->addItem(clearType.toString(), i);
-    }
+void MHGUQuestEditor::initClearTypeDropdown()
+{
+    ui.comboClearType->setModel(LookupModel::fromTable(Resources::DataBundle::builtin().table("quest_clear_type"), this));
 }
 
-void MHGUQuestEditor::initObjectiveDropdowns() const
+void MHGUQuestEditor::initObjectiveDropdowns()
 {
-    auto questObjectives = QFile(":/res/quest_objective.json");
-    if (!questObjectives.open(QIODevice::ReadOnly))
-    {
-        qFatal("Failed to open quest_objective.json");
-    }
-
-    QJsonArray objectives = QJsonDocument::fromJson(questObjectives.readAll()).array();
-    for (const auto [i, objective] : std::views::enumerate(objectives))
-    {
-        ui.comboObjectiveType1->addItem(objective.toString(), i);
-        ui.comboObjectiveType2->addItem(objective.toString(), i);
-        ui.comboSubObjectiveType->addItem(objective.toString(), i);
-    }
-
-    const auto indexChanged = [this](int index, QComboBox* idCombo) {
+    const auto objectives = LookupModel::fromTable(Resources::DataBundle::builtin().table("quest_objective"), this);
+    ui.comboObjectiveType1->setModel(objectives);
+    ui.comboObjectiveType2->setModel(objectives);
+    ui.comboSubObjectiveType->setModel(objectives);
+
+    // Id combos switch between the shared models, clearing them would clear the shared model too
+    const auto emptyModel = new LookupModel({}, this);
+    const auto indexChanged = [this, emptyModel](int index, QComboBox* idCombo) {
         const auto type = (Resources::QuestClearParam)index;
-        idCombo->clear();
-        idCombo->setModel(nullptr);
         switch (type) {
         case Resources::QuestClearParam::Hunt: [[fallthrough]];
         case Resources::QuestClearParam::Capture: [[fallthrough]];
         case Resources::QuestClearParam::HuntAllLargeMonsters: [[fallthrough]];
         case Resources::QuestClearParam::SlayTotalOfTargets:
-            for (auto i = 0; i < ui.comboMonster1->count(); ++i) {
-                idCombo->addItem(ui.comboMonster1->itemText(i), ui.comboMonster1->itemData(i));
-            }
+            idCombo->setModel(monsterModel);
             break;
         case Resources::QuestClearParam::DeliverItem:
             idCombo->setModel(ItemNamesModel);
@@ -599,6 +711,7 @@ void MHGUQuestEditor::initObjectiveDropdowns() const
         case Resources::QuestClearParam::DeliverPawPass: [[fallthrough]];
         case Resources::QuestClearParam::BreakParts: [[fallthrough]];
         case Resources::QuestClearParam::MountAndTopple:
+            idCombo->setModel(emptyModel);
             break;
         }
     };
@@ -616,147 +729,121 @@ void MHGUQuestEditor::initObjectiveDropdowns() const
     });
 }
 
-void MHGUQuestEditor::initItemLevelDropdowns() const
+void MHGUQuestEditor::initItemLevelDropdowns()
 {
-    auto carveLevels = QFile(":/res/quest_carve_level.json");
-    if (!carveLevels.open(QIODevice::ReadOnly))
-    {
-        qFatal("Failed to open quest_carve_level.json");
-    }
-
-    auto levels = QJsonDocument::fromJson(carveLevels.readAll()).array();
-    for (const auto [i, level] : std::views::enumerate(levels))
-    {
-        ui.comboCarveLevel->addItem(level.toString(), i);
-    }
-
-    auto gatheringLevels = QFile(":/res/quest_gather_level.json");
-    if (!gatheringLevels.open(QIODevice::ReadOnly))
-    {
-        qFatal("Failed to open quest_gather_level.json");
-    }
-
-    levels = QJsonDocument::fromJson(gatheringLevels.readAll()).array();
-    for (const auto [i, level] : std::views::enumerate(levels))
-    {
-        ui.comboGatheringLevel->addItem(level.toString(), i);
-    }
-
-    auto fishingLevels = QFile(":/res/quest_fishing_level.json");
-    if (!fishingLevels.open(QIODevice::ReadOnly))
-    {
-        qFatal("Failed to open quest_fishing_level.json");
-    }
-
-    levels = QJsonDocument::fromJson(fishingLevels.readAll()).array();
-    for (const auto [i, level] : std::views::enumerate(levels))
-    {
-        ui.comboFishingLevel->addItem(level.toString(), i);
-    }
+    const auto& bundle = Resources::DataBundle::builtin();
+    ui.comboCarveLevel->setModel(LookupModel::fromTable(bundle.table("quest_carve_level"), this));
+    ui.comboGatheringLevel->setModel(LookupModel::fromTable(bundle.table("quest_gather_level"), this));
+    ui.comboFishingLevel->setModel(LookupModel::fromTable(bundle.table("quest_fishing_level"), this));
 }
 
-void MHGUQuestEditor::initItemNames()
+void MHGUQuestEditor::initItemNames(std::vector<LookupModel::Entry> names)
 {
-    auto itemNamesFile = QFile(":/res/item_names.json");
-    if (!itemNamesFile.open(QIODevice::ReadOnly))
-    {
-        qFatal("Failed to open item_names.json");
-    }
-
-    const auto names = QJsonDocument::fromJson(itemNamesFile.readAll());
-    ItemNames = names.toVariant().toStringList();
-    ItemNamesModel = new QStringListModel(ItemNames, this);
+    ItemNamesModel = new LookupModel(std::move(names), this);
 }
 
 void MHGUQuestEditor::initSpawns()
 {
-    auto spawnsFile = QFile(":/res/spawns.json");
-    if (!spawnsFile.open(QIODevice::ReadOnly))
-    {
-        qFatal("Failed to open spawns.json");
-    }
+    const auto& bundle = Resources::DataBundle::builtin();
+    const auto areas = bundle.table("spawn_areas");
+    const auto spawns = bundle.table("spawns");
 
-    const auto maps = QJsonDocument::fromJson(spawnsFile.readAll()).array();
     const auto font = QFont("Segoe UI", 11);
     const auto menu = new QMenu("Insert Spawn", ui.menuEdit);
     menu->setFont(font);
     ui.menuEdit->addMenu(menu);
-    for (const auto map : maps)
+
+    // Areas are grouped by map, a new map starts whenever the map id changes
+    QMenu* mapMenu = nullptr;
+    s32 currentMapId = -1;
+    for (u32 area = 0; area < areas.rows(); area++)
     {
-        const auto obj = map.toObject();
-        const auto mapId = obj["map_id"].toInt();
+        const auto mapId = areas.integer(area, 0);
         if (mapId == 0)
             continue;
-        const auto mapName = mapNames[mapId];
-        const auto areas = obj["areas"].toArray();
-        const auto mapMenu = new QMenu(mapName, menu);
-        mapMenu->setFont(font);
-        for (const auto area : areas)
+
+        if (mapId != currentMapId)
         {
-            const auto areaObj = area.toObject();
-            const auto areaNo = areaObj["area"].toInt();
-            const auto areaMenu = new QMenu(QString("Area %1").arg(areaNo), mapMenu);
-            areaMenu->setFont(font);
-            const auto spawns = areaObj["spawns"].toArray();
-            for (const auto [i, spawn] : std::views::enumerate(spawns))
-            {
-                const auto spawnObj = spawn.toObject();
-                const Resources::Spawn s{
-                    (u32)spawnObj["round_no"].toInt(),
-                    (u32)areaNo,
-                    (float)spawnObj["angle"].toDouble(),
-                    (float)spawnObj["x"].toDouble(),
-                    (float)spawnObj["y"].toDouble(),
-                    (float)spawnObj["z"].toDouble()
-                };
-
-                const auto action = areaMenu->addAction(QString("Spawn %1").arg(i + 1));
-                action->setFont(font);
-                connect(action, &QAction::triggered, this, [this, s] {
-                    bossSetEditors[ui.tabWidgetMonsterSpawns->currentIndex()]->setSpawn(s);
-                });
-            }
+            currentMapId = mapId;
+            mapMenu = new QMenu(mapNames[mapId], menu);
+            mapMenu->setFont(font);
+            menu->addMenu(mapMenu);
+        }
 
-            mapMenu->addMenu(areaMenu);
+        const auto areaNo = areas.integer(area, 1);
+        const auto first = (u32)areas.integer(area, 2);
+        const auto count = (u32)areas.integer(area, 3);
+        const auto areaMenu = new QMenu(QString("Area %1").arg(areaNo), mapMenu);
+        areaMenu->setFont(font);
+        for (u32 i = 0; i < count; i++)
+        {
+            const auto row = first + i;
+            const Resources::Spawn s{
+                (u32)spawns.integer(row, 0),
+                (u32)areaNo,
+                spawns.number(row, 1),
+                spawns.number(row, 2),
+                spawns.number(row, 3),
+                spawns.number(row, 4)
+            };
+
+            const auto action = areaMenu->addAction(QString("Spawn %1").arg(i + 1));
+            action->setFont(font);
+            connect(action, &QAction::triggered, this, [this, s] {
+                bossSetEditors[ui.tabWidgetMonsterSpawns->currentIndex()]->setSpawn(s);
+            });
         }
 
-        menu->addMenu(mapMenu);
+        mapMenu->addMenu(areaMenu);
     }
 }
 
-void MHGUQuestEditor::addRemEntry(const QString& remName, s32 tabIndex)
+void MHGUQuestEditor::initRewardTables()
 {
-    const auto tab = ui.tabWidgetRewards->widget(tabIndex);
-    const auto scrollArea = tab->findChild<QScrollArea*>(QStringLiteral("scrollAreaRem%1").arg(remName));
-    const auto layout = (QVBoxLayout*)scrollArea->widget()->layout();
-
-    const auto deleteButton = new QToolButton;
-    const auto itemCombo = new QComboBox;
-    const auto amountBox = new QSpinBox;
-    const auto chanceBox = new QSpinBox;
-    const auto itemLayout = new QHBoxLayout;
-
-    itemCombo->setModel(ItemNamesModel);
-    chanceBox->setSuffix("%");
-
-    deleteButton->setText("⨯");
-    connect(deleteButton, &QToolButton::clicked, [itemLayout] {
-        itemLayout->itemAt(0)->widget()->deleteLater(); // Delete button
-        itemLayout->itemAt(1)->widget()->deleteLater(); // Item combo
-        itemLayout->itemAt(2)->widget()->deleteLater(); // Amount box
-        itemLayout->itemAt(3)->widget()->deleteLater(); // Chance box
-        itemLayout->deleteLater();
-    });
+    const std::array views = {
+        ui.tableViewRemMainA,
+        ui.tableViewRemMainB,
+        ui.tableViewRemExtraA,
+        ui.tableViewRemExtraB,
+        ui.tableViewRemSub
+    };
+
+    // One set of delegates serves all reward tables, editors only exist while a cell is edited
+    const auto itemDelegate = new LookupDelegate([](const QModelIndex&) { return ItemNamesModel; }, 190, this);
+    const auto amountDelegate = new SpinBoxDelegate(0, 99, this);
+    const auto chanceDelegate = new SpinBoxDelegate(0, 99, this);
+    chanceDelegate->setSuffix("%");
+
+    for (auto i = 0; i < views.size(); ++i)
+    {
+        const auto view = views[i];
+        rewardModels[i] = new RewardTableModel(ItemNamesModel, this);
+
+        view->setModel(rewardModels[i]);
+        view->setEditTriggers(QAbstractItemView::AllEditTriggers);
+        view->setItemDelegateForColumn(RewardTableModel::Item, itemDelegate);
+        view->setItemDelegateForColumn(RewardTableModel::Amount, amountDelegate);
+        view->setItemDelegateForColumn(RewardTableModel::Chance, chanceDelegate);
+        view->horizontalHeader()->setSectionResizeMode(RewardTableModel::Item, QHeaderView::Stretch);
 
-    itemCombo->setCurrentIndex(0);
-    amountBox->setValue(0);
-    chanceBox->setValue(0);
+        connect(view, &QTableView::customContextMenuRequested, this, [this, view, i](const QPoint& pos) {
+            const auto index = view->indexAt(pos);
+            if (!index.isValid())
+                return;
+
+            QMenu menu;
+            menu.addAction("Delete Entry", this, [this, i, row = index.row()] {
+                rewardModels[i]->removeRow(row);
+            });
+            menu.exec(view->viewport()->mapToGlobal(pos));
+        });
+    }
+}
 
-    itemLayout->addWidget(deleteButton, 0);
-    itemLayout->addWidget(itemCombo, 2);
-    itemLayout->addWidget(amountBox, 1);
-    itemLayout->addWidget(chanceBox, 1);
-    layout->addLayout(itemLayout);
+void MHGUQuestEditor::addRemEntry(s32 tabIndex)
+{
+    const auto model = rewardModels[tabIndex];
+    model->insertRow(model->rowCount());
 }
 
 void MHGUQuestEditor::loadSettings()
@@ -774,6 +861,11 @@ void MHGUQuestEditor::loadSettings()
 
     questListPath = settings.value("quest_list_path").toString();
     autoUpdateQuestList = settings.value("auto_update_quest_list").toBool();
+    compressionPreset = (Resources::CompressionPolicy::Preset)std::clamp(
+        settings.value("compression_preset", (int)Resources::CompressionPolicy::Preset::Default).toInt(),
+        (int)Resources::CompressionPolicy::Preset::Stored,
+        (int)Resources::CompressionPolicy::Preset::Best
+    );
     recentFiles = settings.value("recent_files").toStringList();
 
     settings.endGroup();
@@ -790,6 +882,7 @@ void MHGUQuestEditor::saveSettings() const
     settings.beginGroup("QuestEditor");
     settings.setValue("quest_list_path", questListPath);
     settings.setValue("auto_update_quest_list", autoUpdateQuestList);
+    settings.setValue("compression_preset", (int)compressionPreset);
     settings.setValue("recent_files", recentFiles);
     settings.endGroup();
 }
@@ -853,6 +946,9 @@ void MHGUQuestEditor::loadFile(const QString& path)
         return;
     }
 
+    // Whatever is opened now replaces a quest arc that is still loading
+    questLoadWatcher.cancel();
+
     if (std::ranges::find(recentFiles, path) == recentFiles.end())
     {
         recentFiles.push_front(path);
@@ -874,19 +970,8 @@ void MHGUQuestEditor::loadFile(const QString& path)
     }
     else if (path.endsWith(".arc"))
     {
-        constexpr auto isQuestArc = [](const std::filesystem::path& p) {
-            const auto filename = p.stem().string();
-            if (filename.size() != 8)
-                return false;
-
-            if (filename[0] != 'q')
-                return false;
-
-            return std::all_of(filename.begin() + 1, filename.end(), isdigit);
-        };
-
         const std::filesystem::path fsPath = path.toStdWString();
-        if (!isQuestArc(fsPath))
+        if (!Resources::QuestArc::isQuestArcPath(fsPath))
         {
             auto myArc = std::make_unique<Resources::Arc>(fsPath);
             const auto acEquipArcEntry = myArc->findEntry(acEquipArcPath);
@@ -898,21 +983,20 @@ void MHGUQuestEditor::loadFile(const QString& path)
 
             acEquipArc = std::move(myArc);
             acEquipPath = path;
-            acEquipEditor->setAcEquip(Resources::AcEquip::deserialize(acEquipArcEntry->getData()));
+            getAcEquipEditor()->setAcEquip(Resources::AcEquip::deserialize(acEquipArc->getDataView(*acEquipArcEntry)));
             ui.tabWidgetRoot->setTabEnabled(5, true);
             ui.actionSaveArenaQuests->setEnabled(true);
             return;
         }
 
-        arc = std::make_unique<Resources::QuestArc>(fsPath);
-
-        loadQuestArc();
+        loadQuestArc(path);
+        return;
     }
     else if (path.endsWith(".ape"))
     {
         acEquipArc.reset();
         acEquipPath = path;
-        acEquipEditor->setAcEquip(Resources::AcEquip::deserialize(file.readAll()));
+        getAcEquipEditor()->setAcEquip(Resources::AcEquip::deserialize(file.readAll()));
         ui.actionSaveArenaQuests->setEnabled(true);
         ui.tabWidgetRoot->setTabEnabled(5, true);
         ui.actionSaveArenaQuests->setEnabled(true);
@@ -924,138 +1008,99 @@ void MHGUQuestEditor::loadFile(const QString& path)
         return;
     }
 
+    setOpenedFile(path);
+}
+
+void MHGUQuestEditor::setOpenedFile(const QString& path)
+{
     openedFile = path;
     ui.tabWidgetLanguage->setCurrentIndex(0);
     ui.tabWidgetRoot->setCurrentIndex(0);
     ui.tabWidgetQuestData->setCurrentIndex(0);
 }
 
-void MHGUQuestEditor::loadQuestArc()
+void MHGUQuestEditor::loadQuestArc(const QString& path)
+{
+    loadingFile = path;
+
+    loadProgress->setRange(0, 0);
+    loadProgress->show();
+    cancelLoadButton->show();
+
+    // Replacing the future drops the finished signal of a load that was canceled just before
+    questLoadWatcher.setFuture(QtConcurrent::run(&Resources::QuestSnapshot::load, std::filesystem::path(path.toStdWString())));
+}
+
+void MHGUQuestEditor::onQuestArcLoaded()
+{
+    loadProgress->hide();
+    cancelLoadButton->hide();
+
+    const auto future = questLoadWatcher.future();
+    if (future.isCanceled())
+    {
+        qInfo("Canceled loading %s", qUtf8Printable(loadingFile));
+        return;
+    }
+
+    if (future.resultCount() == 0)
+    {
+        QMessageBox::critical(this, "Open File", QString("Failed to load %1").arg(loadingFile));
+        return;
+    }
+
+    bindQuestSnapshot(*future.result());
+    setOpenedFile(loadingFile);
+}
+
+void MHGUQuestEditor::bindQuestSnapshot(Resources::QuestSnapshot& snapshot)
 {
     using namespace Resources;
 
+    arc = std::move(snapshot.Arc);
+    questData = std::move(snapshot.Data);
+    questLink = std::make_unique<QuestLink>(snapshot.Link);
+
     gmds.clear();
-    rems.clear();
-
-    questData = Resources::QuestData::deserialize(arc->getQuestData().getData());
-
-    constexpr auto setText = [](QLineEdit* name, QLineEdit* client, 
-        QPlainTextEdit* desc, QPlainTextEdit* zako, 
-        QPlainTextEdit* obj, QPlainTextEdit* failure, 
-        QLineEdit* sub, const Resources::Gmd& gmd) {
-        name->setText(gmd.Entries[0].c_str());
-        client->setText(gmd.Entries[1].c_str());
-        desc->setPlainText(gmd.Entries[2].c_str());
-        zako->setPlainText(gmd.Entries[3].c_str());
-        obj->setPlainText(gmd.Entries[4].c_str());
-        failure->setPlainText(gmd.Entries[5].c_str());
-        sub->setText(gmd.Entries[6].c_str());
-    };
+    rems.assign(std::make_move_iterator(snapshot.Rems.begin()), std::make_move_iterator(snapshot.Rems.end()));
 
     ui.tabWidgetRoot->setTabEnabled(1, true); // Enable quest info tab
 
     for (s32 language = Language::Eng; language < Language::Count; ++language)
     {
-        const auto gmdEntry = arc->getGmd(language, questData.Info[language].File);
-        if (!gmdEntry)
+        auto& snapshotGmd = snapshot.Gmds[language];
+        if (!snapshotGmd)
         {
             ui.tabWidgetLanguage->setTabEnabled(language, false);
             gmds.emplace_back();
-            qCritical("Failed to find GMD for language %d", language);
             continue;
         }
 
         ui.tabWidgetLanguage->setTabEnabled(language, true);
-        const auto& gmd = gmds.emplace_back(Gmd::deserialize(gmdEntry->getData()));
+        const auto& gmd = gmds.emplace_back(std::move(*snapshotGmd));
+        const auto& widgets = questTextWidgets[language];
 
-        switch (language)
-        {
-        case Language::Eng:
-            setText(
-                ui.textNameEng, ui.textClientEng,
-                ui.textDescriptionEng, ui.textZakoEng,
-                ui.textObjectiveEng, ui.textFailureEng,
-                ui.textSubquestEng, gmd
-            );
-            break;
-        case Language::Fre:
-            setText(
-                ui.textNameFre, ui.textClientFre,
-                ui.textDescriptionFre, ui.textZakoFre,
-                ui.textObjectiveFre, ui.textFailureFre,
-                ui.textSubquestFre, gmd
-            );
-            break;
-        case Language::Ger:
-            setText(
-                ui.textNameGer, ui.textClientGer,
-                ui.textDescriptionGer, ui.textZakoGer,
-                ui.textObjectiveGer, ui.textFailureGer,
-                ui.textSubquestGer, gmd
-            );
-            break;
-        case Language::Ita:
-            setText(
-                ui.textNameIta, ui.textClientIta,
-                ui.textDescriptionIta, ui.textZakoIta,
-                ui.textObjectiveIta, ui.textFailureIta,
-                ui.textSubquestIta, gmd
-            );
-            break;
-        case Language::Spa:
-            setText(
-                ui.textNameSpa, ui.textClientSpa,
-                ui.textDescriptionSpa, ui.textZakoSpa,
-                ui.textObjectiveSpa, ui.textFailureSpa,
-                ui.textSubquestSpa, gmd
-            );
-            break;
-        case Language::ChT:
-            setText(
-                ui.textNameChT, ui.textClientChT,
-                ui.textDescriptionChT, ui.textZakoChT,
-                ui.textObjectiveChT, ui.textFailureChT,
-                ui.textSubquestChT, gmd
-            );
-            break;
-        case Language::ChS:
-            setText(
-                ui.textNameChS, ui.textClientChS,
-                ui.textDescriptionChS, ui.textZakoChS,
-                ui.textObjectiveChS, ui.textFailureChS,
-                ui.textSubquestChS, gmd
-            );
-            break;
-        case Language::Count: [[fallthrough]];
-        default:
-            break;
-        }
+        widgets.Name->setText(gmd.text(0));
+        widgets.Client->setText(gmd.text(1));
+        widgets.Description->setPlainText(gmd.text(2));
+        widgets.Zako->setPlainText(gmd.text(3));
+        widgets.Objective->setPlainText(gmd.text(4));
+        widgets.Failure->setPlainText(gmd.text(5));
+        widgets.Subquest->setText(gmd.text(6));
     }
 
-    questLink = std::make_unique<QuestLink>(QuestLink::deserialize(arc->getQuestLink().getData()));
-    const auto resources = questLink->resolve(*arc);
-
     ui.tabWidgetRoot->setTabEnabled(2, true); // Enable rewards tab
 
-    rems.emplace_back(resources.RemMain[0] ? Rem::deserialize(resources.RemMain[0]->getData()) : Resources::Rem{});
-    rems.emplace_back(resources.RemMain[1] ? Rem::deserialize(resources.RemMain[1]->getData()) : Resources::Rem{});
-    rems.emplace_back(resources.RemAdd[0] ? Rem::deserialize(resources.RemAdd[0]->getData()) : Resources::Rem{});
-    rems.emplace_back(resources.RemAdd[1] ? Rem::deserialize(resources.RemAdd[1]->getData()) : Resources::Rem{});
-    rems.emplace_back(resources.RemSub ? Rem::deserialize(resources.RemSub->getData()) : Resources::Rem{});
-
-    loadRemIntoUi(rems[0], "MainA", 0);
-    loadRemIntoUi(rems[1], "MainB", 1);
-    loadRemIntoUi(rems[2], "ExtraA", 2);
-    loadRemIntoUi(rems[3], "ExtraB", 3);
-    loadRemIntoUi(rems[4], "Sub", 4);
+    for (s32 i = 0; i < remFlagWidgets.size(); ++i)
+        loadRemIntoUi(rems[i], i);
 
     ui.tabWidgetRoot->setTabEnabled(3, true); // Enable small monsters tab
 
     for (auto i = 0; i < emSetListEditors.size(); ++i)
     {
-        if (resources.EmSetList[i])
+        if (snapshot.EmSetLists[i])
         {
-            emSetListEditors[i]->setEsl(EmSetList::deserialize(resources.EmSetList[i]->getData()));
+            emSetListEditors[i]->setEsl(*snapshot.EmSetLists[i]);
         }
     }
 
@@ -1063,9 +1108,9 @@ void MHGUQuestEditor::loadQuestArc()
 
     for (auto i = 0; i < bossSetEditors.size(); ++i)
     {
-        if (resources.BossSet[i])
+        if (snapshot.BossSets[i])
         {
-            bossSetEditors[i]->setSpawn(BossSet::deserialize(resources.BossSet[i]->getData()));
+            bossSetEditors[i]->setSpawn(*snapshot.BossSets[i]);
         }
     }
 
@@ -1083,11 +1128,8 @@ void MHGUQuestEditor::saveQuestArc(const QString& path)
     // Save UI
     saveQuestDataFromUi();
     saveQuestInfoFromUi();
-    saveRemFromUi(rems[0], "MainA", 0);
-    saveRemFromUi(rems[1], "MainB", 1);
-    saveRemFromUi(rems[2], "ExtraA", 2);
-    saveRemFromUi(rems[3], "ExtraB", 3);
-    saveRemFromUi(rems[4], "Sub", 4);
+    for (s32 i = 0; i < remFlagWidgets.size(); ++i)
+        saveRemFromUi(rems[i], i);
 
     // Save quest info
     using Resources::Language;
@@ -1109,9 +1151,9 @@ void MHGUQuestEditor::saveQuestArc(const QString& path)
         );
 
         const auto serializedGmd = Resources::Gmd::serialize(gmd);
-        gmdEntry->Path = QStringLiteral(R"(%1\quest\questData\questData_%2)")
+        arc->renameEntry(*gmdEntry, QStringLiteral(R"(%1\quest\questData\questData_%2)")
             .arg(Language::toString(language))
-            .arg(questData.Info[language].File);
+            .arg(questData.Info[language].File));
         gmdEntry->setData({
             (const u8*)serializedGmd.data(), 
             (size_t)serializedGmd.size()
@@ -1121,7 +1163,7 @@ void MHGUQuestEditor::saveQuestArc(const QString& path)
     // Save quest data
     const auto serialized = Resources::QuestData::serialize(questData);
     auto& questDataEntry = arc->getQuestData();
-    questDataEntry.Path = QStringLiteral(R"(loc\quest\questData\questData_%1)").arg(questData.Id, 7, 10, QChar(u8'0'));
+    arc->renameEntry(questDataEntry, QStringLiteral(R"(loc\quest\questData\questData_%1)").arg(questData.Id, 7, 10, QChar(u8'0')));
     questDataEntry.setData(serialized);
 
     // Save rem
@@ -1227,15 +1269,12 @@ void MHGUQuestEditor::saveQuestArc(const QString& path)
     }
 
     auto& questLinkEntry = arc->getQuestLink();
-    questLinkEntry.Path = QStringLiteral(R"(loc\quest\questLink\questLink_%1)").arg(questData.Id, 7, 10, QChar(u8'0'));
+    arc->renameEntry(questLinkEntry, QStringLiteral(R"(loc\quest\questLink\questLink_%1)").arg(questData.Id, 7, 10, QChar(u8'0')));
     questLinkEntry.setData(Resources::QuestLink::serialize(*questLink));
 
-    if (path.isEmpty())
-        arc->save();
-    else
-        arc->save(path.toStdWString());
-
-    if (autoUpdateQuestList)
+    arc->setCompressionPolicy(Resources::CompressionPolicy::fromPreset(compressionPreset));
+    const auto saved = path.isEmpty() ? arc->save() : arc->save(path.toStdWString());
+    if (saved && autoUpdateQuestList)
         saveQuestArcToQuestList();
 }
 
@@ -1245,7 +1284,7 @@ void MHGUQuestEditor::saveQuestFile(const QString& path) const
     file.write(Resources::QuestData::serialize(questData));
 }
 
-void MHGUQuestEditor::saveQuestArcToQuestList() const
+void MHGUQuestEditor::saveQuestArcToQuestList()
 {
     if (!arc)
     {
@@ -1265,44 +1304,79 @@ void MHGUQuestEditor::saveQuestArcToQuestList() const
         return;
     }
 
-    const auto& serialized = arc->getQuestData();
-    Resources::QuestArc questList(questListPath.toStdWString(), false);
-    const auto questDataEntry = questList.getQuestData(questData.Id);
-    if (questDataEntry) // Update existing entry
+    // Only the handful of entries we touch need to be read, the rest stays in the file mapping
+    Resources::QuestArc questList(questListPath.toStdWString(), false, Resources::Arc::LoadMode::Mapped);
+
+    // Payloads are already compressed from saving the quest arc and are shared as is
+    questList.copyRawEntry(arc->getQuestData());
+
+    for (s32 language = 0; language < gmds.size(); ++language)
     {
-        questDataEntry->setData(serialized.getData(false), false);
-        questDataEntry->RealSize = serialized.RealSize; // Update real size since setData(..., false) doesn't update it
+        if (language >= gmds.size() || !ui.tabWidgetLanguage->isTabEnabled(language))
+            continue;
+
+        const auto gmdEntry = arc->getGmd(language, questData.Info[language].File);
+        if (gmdEntry)
+            questList.copyRawEntry(*gmdEntry);
     }
-    else // Insert new entry
+
+    questList.setCompressionPolicy(Resources::CompressionPolicy::fromPreset(compressionPreset));
+    if (!questList.saveIncremental())
+        QMessageBox::warning(this, "Update Quest List", "Failed to save the quest list, it still holds the previous version of the quest.");
+}
+
+void MHGUQuestEditor::compactQuestList()
+{
+    if (questListPath.isEmpty() || !QFile::exists(questListPath))
     {
-        questList.addQuestData(questData.Id, serialized.getData(false), true, serialized.RealSize);
+        qCritical("Quest list path does not exist");
+        return;
     }
 
-    for (s32 language = 0; language < gmds.size(); ++language)
+    Resources::QuestArc questList(questListPath.toStdWString(), false, Resources::Arc::LoadMode::Mapped);
+    questList.setCompressionPolicy(Resources::CompressionPolicy::fromPreset(compressionPreset));
+    if (!questList.compact())
+        QMessageBox::warning(this, "Compact Quest List", "Failed to save the quest list, it was left as it was.");
+}
+
+void MHGUQuestEditor::syncQuestFolderToQuestList()
+{
+    if (questListPath.isEmpty() || !QFile::exists(questListPath))
     {
-        if (language >= gmds.size() || !ui.tabWidgetLanguage->isTabEnabled(language))
-            continue;
+        qCritical("Quest list path does not exist");
+        return;
+    }
 
-        const auto name = questData.Info[language].File;
-        const auto gmdEntry = arc->getGmd(language, name);
-        const auto targetGmd = questList.getGmd(language, name);
-        if (targetGmd) // Update existing entry
-        {
-            targetGmd->setData(gmdEntry->getData(false), false);
-            targetGmd->RealSize = gmdEntry->RealSize; // Update real size since setData(..., false) doesn't update it
-        }
-        else // Insert new entry
-        {
-            questList.addGmd(language, name, gmdEntry->getData(false), true, gmdEntry->RealSize);
-        }
+    const auto folder = QFileDialog::getExistingDirectory(this, "Select Quest Folder");
+    if (folder.isNull())
+        return;
+
+    const auto questArcs = Resources::QuestListSync::findQuestArcs(folder.toStdWString());
+    if (questArcs.empty())
+    {
+        QMessageBox::information(this, "Sync Quest Folder", "No quest arcs found in the selected folder.");
+        return;
     }
 
-    questList.save();
+    const auto result = Resources::QuestListSync::sync(
+        questListPath.toStdWString(),
+        questArcs,
+        Resources::CompressionPolicy::fromPreset(compressionPreset)
+    );
+
+    auto message = QString("Merged %1 of %2 quest arcs into the quest list.").arg(result.Merged).arg(questArcs.size());
+    for (const auto& failed : result.Failed)
+        message += QString("\nFailed to read %1").arg(QString::fromStdWString(failed.filename().wstring()));
+
+    if (result.Merged > 0 && !result.Saved)
+        message += "\nFailed to save the quest list.";
+
+    QMessageBox::information(this, "Sync Quest Folder", message);
 }
 
 void MHGUQuestEditor::saveAcEquip()
 {
-    if (acEquipPath.isEmpty() || !acEquipEditor->getAcEquip())
+    if (acEquipPath.isEmpty() || !acEquipEditor || !acEquipEditor->getAcEquip())
     {
         qCritical("No ac equip path set");
         return;
@@ -1345,20 +1419,19 @@ void MHGUQuestEditor::saveAcEquip()
             acEquipArc->addEntry(acEquipArcPath, "rAcPlayerEquip", serialized);
         }
 
+        acEquipArc->setCompressionPolicy(Resources::CompressionPolicy::fromPreset(compressionPreset));
         acEquipArc->save();
     }
 }
 
 void MHGUQuestEditor::loadQuestDataIntoUi()
 {
+    // Lookup models answer findData from their value index instead of scanning
     const auto setIndexFromDataIntegral = []<Integral T> (QComboBox * combo, T data) {
-        for (auto i = 0; i < combo->count(); ++i)
+        const auto index = combo->findData((int)data);
+        if (index >= 0)
         {
-            if (combo->itemData(i).toInt() == data)
-            {
-                combo->setCurrentIndex(i);
-                return;
-            }
+            combo->setCurrentIndex(index);
         }
     };
     const auto setIndexFromData = [this, setIndexFromDataIntegral]<AnyIntegral T> (QComboBox * combo, T data) {
@@ -1380,29 +1453,22 @@ void MHGUQuestEditor::loadQuestDataIntoUi()
         }
     };
 
+    // Spin boxes, see QuestFieldBindings
+    for (const auto& [spinBox, field] : questFieldWidgets)
+        spinBox->setValue(field.get(questData));
+
     // General
-    ui.spinBoxQuestId->setValue(questData.Id);
     setIndexFromData(ui.comboQuestType, questData.Type);
     setIndexFromData(ui.comboQuestSubType, questData.SubType);
     setIndexFromData(ui.comboQuestLevel, questData.Level);
     setIndexFromData(ui.comboMonsterLevel, questData.EnemyLevel);
     setIndexFromData(ui.comboMap, questData.Map);
     setIndexFromData(ui.comboSpawnType, questData.StartType);
-    ui.spinBoxTimeLimit->setValue(questData.QuestTime);
-    ui.spinBoxFaints->setValue(questData.Faints);
-    ui.spinBoxArenaEquipId->setValue(questData.ArenaEquipId);
     setIndexFromData(ui.comboBgm, questData.BgmType);
     setIndexFromData(ui.comboRequirement1, questData.Requirement1);
     setIndexFromData(ui.comboRequirement2, questData.Requirement2);
     setIndexFromData(ui.comboComboRequirement, questData.ComboRequirement);
     setIndexFromData(ui.comboClearType, questData.ClearType);
-    ui.spinBoxFaints->setValue(questData.Faints);
-    ui.spinBoxQuestZenny->setValue(questData.Reward);
-    ui.spinBoxSubquestZenny->setValue(questData.SubReward);
-    ui.spinBoxQuestPoints->setValue(questData.ClearVillagePoints);
-    ui.spinBoxSubquestPoints->setValue(questData.SubVillagePoints);
-    ui.spinBoxQuestHrp->setValue(questData.HunterRankPoints);
-    ui.spinBoxSubquestHrp->setValue(questData.SubHunterRankPoints);
 
     setIndex(ui.comboIcon1, questData.Icons[0]);
     setIndex(ui.comboIcon2, questData.Icons[1]);
@@ -1439,137 +1505,44 @@ void MHGUQuestEditor::loadQuestDataIntoUi()
     setIndexFromDataObjective(ui.comboObjectiveId2, questData.ClearConditions[1].Param, questData.ClearConditions[1].Value);
     setIndexFromDataObjective(ui.comboSubObjectiveId, questData.SubClearCondition.Param, questData.SubClearCondition.Value);
 
-    ui.spinBoxObjective1Amount->setValue(questData.ClearConditions[0].Count);
-    ui.spinBoxObjective2Amount->setValue(questData.ClearConditions[1].Count);
-    ui.spinBoxSubObjectiveAmount->setValue(questData.SubClearCondition.Count);
-
     // Monsters
-    setIndexFromData(ui.comboMonster1, questData.Monsters[0].Id);
-    setIndexFromData(ui.comboMonster2, questData.Monsters[1].Id);
-    setIndexFromData(ui.comboMonster3, questData.Monsters[2].Id);
-    setIndexFromData(ui.comboMonster4, questData.Monsters[3].Id);
-    setIndexFromData(ui.comboMonster5, questData.Monsters[4].Id);
-
-    ui.spinBoxMonster1Special->setValue(questData.Monsters[0].SubType);
-    ui.spinBoxMonster2Special->setValue(questData.Monsters[1].SubType);
-    ui.spinBoxMonster3Special->setValue(questData.Monsters[2].SubType);
-    ui.spinBoxMonster4Special->setValue(questData.Monsters[3].SubType);
-    ui.spinBoxMonster5Special->setValue(questData.Monsters[4].SubType);
-
-    ui.spinBoxMonster1State->setValue(questData.Monsters[0].AuraType);
-    ui.spinBoxMonster2State->setValue(questData.Monsters[1].AuraType);
-    ui.spinBoxMonster3State->setValue(questData.Monsters[2].AuraType);
-    ui.spinBoxMonster4State->setValue(questData.Monsters[3].AuraType);
-    ui.spinBoxMonster5State->setValue(questData.Monsters[4].AuraType);
-
-    ui.spinBoxMonster1RestoreAmount->setValue(questData.Monsters[0].RestoreAmount);
-    ui.spinBoxMonster2RestoreAmount->setValue(questData.Monsters[1].RestoreAmount);
-    ui.spinBoxMonster3RestoreAmount->setValue(questData.Monsters[2].RestoreAmount);
-    ui.spinBoxMonster4RestoreAmount->setValue(questData.Monsters[3].RestoreAmount);
-    ui.spinBoxMonster5RestoreAmount->setValue(questData.Monsters[4].RestoreAmount);
-
-    setIndex(ui.comboMonster1Health, questData.Monsters[0].HealthTableIndex);
-    setIndex(ui.comboMonster2Health, questData.Monsters[1].HealthTableIndex);
-    setIndex(ui.comboMonster3Health, questData.Monsters[2].HealthTableIndex);
-    setIndex(ui.comboMonster4Health, questData.Monsters[3].HealthTableIndex);
-    setIndex(ui.comboMonster5Health, questData.Monsters[4].HealthTableIndex);
-
-    setIndex(ui.comboMonster1Attack, questData.Monsters[0].AttackTableIndex);
-    setIndex(ui.comboMonster2Attack, questData.Monsters[1].AttackTableIndex);
-    setIndex(ui.comboMonster3Attack, questData.Monsters[2].AttackTableIndex);
-    setIndex(ui.comboMonster4Attack, questData.Monsters[3].AttackTableIndex);
-    setIndex(ui.comboMonster5Attack, questData.Monsters[4].AttackTableIndex);
-
-    setIndex(ui.comboMonster1Other, questData.Monsters[0].HealthTableIndex);
-    setIndex(ui.comboMonster2Other, questData.Monsters[1].HealthTableIndex);
-    setIndex(ui.comboMonster3Other, questData.Monsters[2].HealthTableIndex);
-    setIndex(ui.comboMonster4Other, questData.Monsters[3].HealthTableIndex);
-    setIndex(ui.comboMonster5Other, questData.Monsters[4].HealthTableIndex);
-
-    ui.spinBoxMonster1Difficulty->setValue(questData.Monsters[0].Difficulty);
-    ui.spinBoxMonster2Difficulty->setValue(questData.Monsters[1].Difficulty);
-    ui.spinBoxMonster3Difficulty->setValue(questData.Monsters[2].Difficulty);
-    ui.spinBoxMonster4Difficulty->setValue(questData.Monsters[3].Difficulty);
-    ui.spinBoxMonster5Difficulty->setValue(questData.Monsters[4].Difficulty);
-
-    ui.spinBoxMonster1Size->setValue(questData.Monsters[0].Size);
-    ui.spinBoxMonster2Size->setValue(questData.Monsters[1].Size);
-    ui.spinBoxMonster3Size->setValue(questData.Monsters[2].Size);
-    ui.spinBoxMonster4Size->setValue(questData.Monsters[3].Size);
-    ui.spinBoxMonster5Size->setValue(questData.Monsters[4].Size);
-
-    ui.spinBoxMonster1SizeTable->setValue(questData.Monsters[0].SizeTableIndex);
-    ui.spinBoxMonster2SizeTable->setValue(questData.Monsters[1].SizeTableIndex);
-    ui.spinBoxMonster3SizeTable->setValue(questData.Monsters[2].SizeTableIndex);
-    ui.spinBoxMonster4SizeTable->setValue(questData.Monsters[3].SizeTableIndex);
-    ui.spinBoxMonster5SizeTable->setValue(questData.Monsters[4].SizeTableIndex);
-
-    ui.spinBoxMonster1StaminaTable->setValue(questData.Monsters[0].StaminaTableIndex);
-    ui.spinBoxMonster2StaminaTable->setValue(questData.Monsters[1].StaminaTableIndex);
-    ui.spinBoxMonster3StaminaTable->setValue(questData.Monsters[2].StaminaTableIndex);
-    ui.spinBoxMonster4StaminaTable->setValue(questData.Monsters[3].StaminaTableIndex);
-    ui.spinBoxMonster5StaminaTable->setValue(questData.Monsters[4].StaminaTableIndex);
+    for (auto i = 0; i < monsterWidgets.size(); i++)
+    {
+        const auto& widgets = monsterWidgets[i];
+        const auto& monster = questData.Monsters[i];
+
+        setIndexFromData(widgets.Monster, monster.Id);
+        widgets.Special->setValue(monster.SubType);
+        widgets.State->setValue(monster.AuraType);
+        widgets.RestoreAmount->setValue(monster.RestoreAmount);
+        setIndex(widgets.Health, monster.HealthTableIndex);
+        setIndex(widgets.Attack, monster.AttackTableIndex);
+        setIndex(widgets.Other, monster.OtherTableIndex);
+        widgets.Difficulty->setValue(monster.Difficulty);
+        widgets.Size->setValue(monster.Size);
+        widgets.SizeTable->setValue(monster.SizeTableIndex);
+        widgets.StaminaTable->setValue(monster.StaminaTableIndex);
+    }
 
     setIndex(ui.comboZakoHealth, questData.SmallMonsterHpIndex);
     setIndex(ui.comboZakoAttack, questData.SmallMonsterAtkIndex);
     setIndex(ui.comboZakoOther, questData.SmallMonsterOtherIndex);
 
     // Items
-    ui.spinBoxSuppliesALabel->setValue(questData.Supplies[0].SuppLabel);
-    ui.spinBoxSuppliesAType->setValue(questData.Supplies[0].SuppType);
-    ui.spinBoxSuppliesATarget->setValue(questData.Supplies[0].SuppTarget);
-    ui.spinBoxSuppliesATargetAmount->setValue(questData.Supplies[0].SuppTargetCount);
-
-    ui.spinBoxSuppliesBLabel->setValue(questData.Supplies[1].SuppLabel);
-    ui.spinBoxSuppliesBType->setValue(questData.Supplies[1].SuppType);
-    ui.spinBoxSuppliesBTarget->setValue(questData.Supplies[1].SuppTarget);
-    ui.spinBoxSuppliesBTargetAmount->setValue(questData.Supplies[1].SuppTargetCount);
-
     setIndexFromData(ui.comboCarveLevel, questData.CarveLevel);
     setIndexFromData(ui.comboGatheringLevel, questData.GatheringLevel);
     setIndexFromData(ui.comboFishingLevel, questData.FishingLevel);
 
-    ui.spinBoxRewardBoxes1->setValue(questData.RemAddFrame[0]);
-    ui.spinBoxRewardBoxes2->setValue(questData.RemAddFrame[1]);
-    ui.spinBoxMaxExtraBoxes->setValue(questData.RemAddLotMax);
-
     // Spawns
-    ui.spinBoxMonster2SetType->setValue(questData.EnemySet2.SetType);
-    ui.spinBoxMonster2SetTargetId->setValue(questData.EnemySet2.TargetId);
-    ui.spinBoxMonster2SetTargetAmount->setValue(questData.EnemySet2.TargetCount);
-
-    ui.spinBoxMonster3SetType->setValue(questData.EnemySet3.SetType);
-    ui.spinBoxMonster3SetTargetId->setValue(questData.EnemySet3.TargetId);
-    ui.spinBoxMonster3SetTargetAmount->setValue(questData.EnemySet3.TargetCount);
-
-    ui.spinBoxMonster1SpawnType->setValue(questData.MonsterSpawns[0].SpawnType);
-    ui.spinBoxMonster2SpawnType->setValue(questData.MonsterSpawns[1].SpawnType);
-    ui.spinBoxMonster3SpawnType->setValue(questData.MonsterSpawns[2].SpawnType);
-    ui.spinBoxMonster4SpawnType->setValue(questData.MonsterSpawns[3].SpawnType);
-    ui.spinBoxMonster5SpawnType->setValue(questData.MonsterSpawns[4].SpawnType);
-
-    ui.spinBoxMonster1SpawnTargetType->setValue(questData.MonsterSpawns[0].SpawnTargetType);
-    ui.spinBoxMonster2SpawnTargetType->setValue(questData.MonsterSpawns[1].SpawnTargetType);
-    ui.spinBoxMonster3SpawnTargetType->setValue(questData.MonsterSpawns[2].SpawnTargetType);
-    ui.spinBoxMonster4SpawnTargetType->setValue(questData.MonsterSpawns[3].SpawnTargetType);
-    ui.spinBoxMonster5SpawnTargetType->setValue(questData.MonsterSpawns[4].SpawnTargetType);
-
-    ui.spinBoxMonster1SpawnTargetAmount->setValue(questData.MonsterSpawns[0].SpawnTargetCount);
-    ui.spinBoxMonster2SpawnTargetAmount->setValue(questData.MonsterSpawns[1].SpawnTargetCount);
-    ui.spinBoxMonster3SpawnTargetAmount->setValue(questData.MonsterSpawns[2].SpawnTargetCount);
-    ui.spinBoxMonster4SpawnTargetAmount->setValue(questData.MonsterSpawns[3].SpawnTargetCount);
-    ui.spinBoxMonster5SpawnTargetAmount->setValue(questData.MonsterSpawns[4].SpawnTargetCount);
-
-    ui.spinBoxStrayRandom->setValue(questData.StrayRand);
-    ui.spinBoxStrayStart->setValue(questData.StrayStartTime);
-    ui.spinBoxStrayStartRandom->setValue(questData.StrayStartRand);
-    ui.spinBoxStrayLimit3->setValue(questData.StrayLimit345[0]);
-    ui.spinBoxStrayLimit4->setValue(questData.StrayLimit345[1]);
-    ui.spinBoxStrayLimit5->setValue(questData.StrayLimit345[2]);
-    ui.spinBoxStrayRandom3->setValue(questData.StrayRand345[0]);
-    ui.spinBoxStrayRandom4->setValue(questData.StrayRand345[1]);
-    ui.spinBoxStrayRandom5->setValue(questData.StrayRand345[2]);
-    ui.spinBoxExtraTicketCount->setValue(questData.ExtraTicketCount);
+    for (auto i = 0; i < monsterWidgets.size(); i++)
+    {
+        const auto& widgets = monsterWidgets[i];
+        const auto& spawn = questData.MonsterSpawns[i];
+
+        widgets.SpawnType->setValue(spawn.SpawnType);
+        widgets.SpawnTargetType->setValue(spawn.SpawnTargetType);
+        widgets.SpawnTargetAmount->setValue(spawn.SpawnTargetCount);
+    }
 }
 
 void MHGUQuestEditor::saveQuestDataFromUi()
@@ -1582,28 +1555,22 @@ void MHGUQuestEditor::saveQuestDataFromUi()
         data = static_cast<T>(combo->currentIndex());
     };
 
+    // Spin boxes, see QuestFieldBindings
+    for (const auto& [spinBox, field] : questFieldWidgets)
+        field.set(questData, spinBox->value());
+
     // General
-    questData.Id = ui.spinBoxQuestId->value();
     setFieldFromData(ui.comboQuestType, questData.Type);
     setFieldFromData(ui.comboQuestSubType, questData.SubType);
     setFieldFromData(ui.comboQuestLevel, questData.Level);
     setFieldFromData(ui.comboMonsterLevel, questData.EnemyLevel);
     setFieldFromData(ui.comboMap, questData.Map);
     setFieldFromData(ui.comboSpawnType, questData.StartType);
-    questData.QuestTime = ui.spinBoxTimeLimit->value();
-    questData.Faints = ui.spinBoxFaints->value();
-    questData.ArenaEquipId = ui.spinBoxArenaEquipId->value();
     setFieldFromData(ui.comboBgm, questData.BgmType);
     setFieldFromData(ui.comboRequirement1, questData.Requirement1);
     setFieldFromData(ui.comboRequirement2, questData.Requirement2);
     setFieldFromData(ui.comboComboRequirement, questData.ComboRequirement);
     setFieldFromData(ui.comboClearType, questData.ClearType);
-    questData.Reward = ui.spinBoxQuestZenny->value();
-    questData.SubReward = ui.spinBoxSubquestZenny->value();
-    questData.ClearVillagePoints = ui.spinBoxQuestPoints->value();
-    questData.SubVillagePoints = ui.spinBoxSubquestPoints->value();
-    questData.HunterRankPoints = ui.spinBoxQuestHrp->value();
-    questData.SubHunterRankPoints = ui.spinBoxSubquestHrp->value();
 
     setFieldFromIndex(ui.comboIcon1, questData.Icons[0]);
     setFieldFromIndex(ui.comboIcon2, questData.Icons[1]);
@@ -1640,137 +1607,47 @@ void MHGUQuestEditor::saveQuestDataFromUi()
     setFieldFromDataObjective(ui.comboObjectiveId2, questData.ClearConditions[1].Param, questData.ClearConditions[1].Value);
     setFieldFromDataObjective(ui.comboSubObjectiveId, questData.SubClearCondition.Param, questData.SubClearCondition.Value);
 
-    questData.ClearConditions[0].Count = ui.spinBoxObjective1Amount->value();
-    questData.ClearConditions[1].Count = ui.spinBoxObjective2Amount->value();
-    questData.SubClearCondition.Count = ui.spinBoxSubObjectiveAmount->value();
-
     // Monsters
-    setFieldFromData(ui.comboMonster1, questData.Monsters[0].Id);
-    setFieldFromData(ui.comboMonster2, questData.Monsters[1].Id);
-    setFieldFromData(ui.comboMonster3, questData.Monsters[2].Id);
-    setFieldFromData(ui.comboMonster4, questData.Monsters[3].Id);
-    setFieldFromData(ui.comboMonster5, questData.Monsters[4].Id);
-
-    questData.Monsters[0].SubType = ui.spinBoxMonster1Special->value();
-    questData.Monsters[1].SubType = ui.spinBoxMonster2Special->value();
-    questData.Monsters[2].SubType = ui.spinBoxMonster3Special->value();
-    questData.Monsters[3].SubType = ui.spinBoxMonster4Special->value();
-    questData.Monsters[4].SubType = ui.spinBoxMonster5Special->value();
-
-    questData.Monsters[0].AuraType = ui.spinBoxMonster1State->value();
-    questData.Monsters[1].AuraType = ui.spinBoxMonster2State->value();
-    questData.Monsters[2].AuraType = ui.spinBoxMonster3State->value();
-    questData.Monsters[3].AuraType = ui.spinBoxMonster4State->value();
-    questData.Monsters[4].AuraType = ui.spinBoxMonster5State->value();
-
-    questData.Monsters[0].RestoreAmount = ui.spinBoxMonster1RestoreAmount->value();
-    questData.Monsters[1].RestoreAmount = ui.spinBoxMonster2RestoreAmount->value();
-    questData.Monsters[2].RestoreAmount = ui.spinBoxMonster3RestoreAmount->value();
-    questData.Monsters[3].RestoreAmount = ui.spinBoxMonster4RestoreAmount->value();
-    questData.Monsters[4].RestoreAmount = ui.spinBoxMonster5RestoreAmount->value();
-
-    setFieldFromIndex(ui.comboMonster1Health, questData.Monsters[0].HealthTableIndex);
-    setFieldFromIndex(ui.comboMonster2Health, questData.Monsters[1].HealthTableIndex);
-    setFieldFromIndex(ui.comboMonster3Health, questData.Monsters[2].HealthTableIndex);
-    setFieldFromIndex(ui.comboMonster4Health, questData.Monsters[3].HealthTableIndex);
-    setFieldFromIndex(ui.comboMonster5Health, questData.Monsters[4].HealthTableIndex);
-
-    setFieldFromIndex(ui.comboMonster1Attack, questData.Monsters[0].AttackTableIndex);
-    setFieldFromIndex(ui.comboMonster2Attack, questData.Monsters[1].AttackTableIndex);
-    setFieldFromIndex(ui.comboMonster3Attack, questData.Monsters[2].AttackTableIndex);
-    setFieldFromIndex(ui.comboMonster4Attack, questData.Monsters[3].AttackTableIndex);
-    setFieldFromIndex(ui.comboMonster5Attack, questData.Monsters[4].AttackTableIndex);
-
-    setFieldFromIndex(ui.comboMonster1Other, questData.Monsters[0].OtherTableIndex);
-    setFieldFromIndex(ui.comboMonster2Other, questData.Monsters[1].OtherTableIndex);
-    setFieldFromIndex(ui.comboMonster3Other, questData.Monsters[2].OtherTableIndex);
-    setFieldFromIndex(ui.comboMonster4Other, questData.Monsters[3].OtherTableIndex);
-    setFieldFromIndex(ui.comboMonster5Other, questData.Monsters[4].OtherTableIndex);
-
-    questData.Monsters[0].Difficulty = ui.spinBoxMonster1Difficulty->value();
-    questData.Monsters[1].Difficulty = ui.spinBoxMonster2Difficulty->value();
-    questData.Monsters[2].Difficulty = ui.spinBoxMonster3Difficulty->value();
-    questData.Monsters[3].Difficulty = ui.spinBoxMonster4Difficulty->value();
-    questData.Monsters[4].Difficulty = ui.spinBoxMonster5Difficulty->value();
-
-    questData.Monsters[0].Size = ui.spinBoxMonster1Size->value();
-    questData.Monsters[1].Size = ui.spinBoxMonster2Size->value();
-    questData.Monsters[2].Size = ui.spinBoxMonster3Size->value();
-    questData.Monsters[3].Size = ui.spinBoxMonster4Size->value();
-    questData.Monsters[4].Size = ui.spinBoxMonster5Size->value();
-
-    questData.Monsters[0].SizeTableIndex = ui.spinBoxMonster1SizeTable->value();
-    questData.Monsters[1].SizeTableIndex = ui.spinBoxMonster2SizeTable->value();
-    questData.Monsters[2].SizeTableIndex = ui.spinBoxMonster3SizeTable->value();
-    questData.Monsters[3].SizeTableIndex = ui.spinBoxMonster4SizeTable->value();
-    questData.Monsters[4].SizeTableIndex = ui.spinBoxMonster5SizeTable->value();
-
-    questData.Monsters[0].StaminaTableIndex = ui.spinBoxMonster1StaminaTable->value();
-    questData.Monsters[1].StaminaTableIndex = ui.spinBoxMonster2StaminaTable->value();
-    questData.Monsters[2].StaminaTableIndex = ui.spinBoxMonster3StaminaTable->value();
-    questData.Monsters[3].StaminaTableIndex = ui.spinBoxMonster4StaminaTable->value();
-    questData.Monsters[4].StaminaTableIndex = ui.spinBoxMonster5StaminaTable->value();
+    for (auto i = 0; i < monsterWidgets.size(); i++)
+    {
+        const auto& widgets = monsterWidgets[i];
+        auto& monster = questData.Monsters[i];
+
+        setFieldFromData(widgets.Monster, monster.Id);
+        monster.SubType = widgets.Special->value();
+        monster.AuraType = widgets.State->value();
+        monster.RestoreAmount = widgets.RestoreAmount->value();
+        setFieldFromIndex(widgets.Health, monster.HealthTableIndex);
+        setFieldFromIndex(widgets.Attack, monster.AttackTableIndex);
+        setFieldFromIndex(widgets.Other, monster.OtherTableIndex);
+        monster.Difficulty = widgets.Difficulty->value();
+        monster.Size = widgets.Size->value();
+        monster.SizeTableIndex = widgets.SizeTable->value();
+        monster.StaminaTableIndex = widgets.StaminaTable->value();
+    }
 
     setFieldFromIndex(ui.comboZakoHealth, questData.SmallMonsterHpIndex);
     setFieldFromIndex(ui.comboZakoAttack, questData.SmallMonsterAtkIndex);
     setFieldFromIndex(ui.comboZakoOther, questData.SmallMonsterOtherIndex);
 
     // Items
-    questData.Supplies[0].SuppLabel = ui.spinBoxSuppliesALabel->value();
-    questData.Supplies[0].SuppType = ui.spinBoxSuppliesAType->value();
-    questData.Supplies[0].SuppTarget = ui.spinBoxSuppliesATarget->value();
-    questData.Supplies[0].SuppTargetCount = ui.spinBoxSuppliesATargetAmount->value();
-
-    questData.Supplies[1].SuppLabel = ui.spinBoxSuppliesBLabel->value();
-    questData.Supplies[1].SuppType = ui.spinBoxSuppliesBType->value();
-    questData.Supplies[1].SuppTarget = ui.spinBoxSuppliesBTarget->value();
-    questData.Supplies[1].SuppTargetCount = ui.spinBoxSuppliesBTargetAmount->value();
-
     setFieldFromData(ui.comboCarveLevel, questData.CarveLevel);
     setFieldFromData(ui.comboGatheringLevel, questData.GatheringLevel);
     setFieldFromData(ui.comboFishingLevel, questData.FishingLevel);
 
-    questData.RemAddFrame[0] = ui.spinBoxRewardBoxes1->value();
-    questData.RemAddFrame[1] = ui.spinBoxRewardBoxes2->value();
-    questData.RemAddLotMax = ui.spinBoxMaxExtraBoxes->value();
-
     // Spawns
-    questData.EnemySet2.SetType = ui.spinBoxMonster2SetType->value();
-    questData.EnemySet2.TargetId = ui.spinBoxMonster2SetTargetId->value();
-    questData.EnemySet2.TargetCount = ui.spinBoxMonster2SetTargetAmount->value();
-
-    questData.EnemySet3.SetType = ui.spinBoxMonster3SetType->value();
-    questData.EnemySet3.TargetId = ui.spinBoxMonster3SetTargetId->value();
-    questData.EnemySet3.TargetCount = ui.spinBoxMonster3SetTargetAmount->value();
-
-    questData.MonsterSpawns[0].SpawnType = ui.spinBoxMonster1SpawnType->value();
-    questData.MonsterSpawns[1].SpawnType = ui.spinBoxMonster2SpawnType->value();
-    questData.MonsterSpawns[2].SpawnType = ui.spinBoxMonster3SpawnType->value();
-    questData.MonsterSpawns[3].SpawnType = ui.spinBoxMonster4SpawnType->value();
-    questData.MonsterSpawns[4].SpawnType = ui.spinBoxMonster5SpawnType->value();
-
-    questData.MonsterSpawns[0].SpawnTargetType = ui.spinBoxMonster1SpawnTargetType->value();
-    questData.MonsterSpawns[1].SpawnTargetType = ui.spinBoxMonster2SpawnTargetType->value();
-    questData.MonsterSpawns[2].SpawnTargetType = ui.spinBoxMonster3SpawnTargetType->value();
-    questData.MonsterSpawns[3].SpawnTargetType = ui.spinBoxMonster4SpawnTargetType->value();
-    questData.MonsterSpawns[4].SpawnTargetType = ui.spinBoxMonster5SpawnTargetType->value();
-
-    questData.MonsterSpawns[0].SpawnTargetCount = ui.spinBoxMonster1SpawnTargetAmount->value();
-    questData.MonsterSpawns[1].SpawnTargetCount = ui.spinBoxMonster2SpawnTargetAmount->value();
-    questData.MonsterSpawns[2].SpawnTargetCount = ui.spinBoxMonster3SpawnTargetAmount->value();
-    questData.MonsterSpawns[3].SpawnTargetCount = ui.spinBoxMonster4SpawnTargetAmount->value();
-    questData.MonsterSpawns[4].SpawnTargetCount = ui.spinBoxMonster5SpawnTargetAmount->value();
-
-    questData.StrayRand = ui.spinBoxStrayRandom->value();
-    questData.StrayStartTime = ui.spinBoxStrayStart->value();
-    questData.StrayStartRand = ui.spinBoxStrayStartRandom->value();
-    questData.StrayLimit345[0] = ui.spinBoxStrayLimit3->value();
-    questData.StrayLimit345[1] = ui.spinBoxStrayLimit4->value();
-    questData.StrayLimit345[2] = ui.spinBoxStrayLimit5->value();
-    questData.StrayRand345[0] = ui.spinBoxStrayRandom3->value();
-    questData.StrayRand345[1] = ui.spinBoxStrayRandom4->value();
-    questData.StrayRand345[2] = ui.spinBoxStrayRandom5->value();
-    questData.ExtraTicketCount = ui.spinBoxExtraTicketCount->value();
+    for (auto i = 0; i < monsterWidgets.size(); i++)
+    {
+        const auto& widgets = monsterWidgets[i];
+        auto& spawn = questData.MonsterSpawns[i];
+
+        spawn.SpawnType = widgets.SpawnType->value();
+        spawn.SpawnTargetType = widgets.SpawnTargetType->value();
+        spawn.SpawnTargetCount = widgets.SpawnTargetAmount->value();
+    }
+
+    for (const auto& error : Resources::validateQuestData(questData))
+        qWarning("Saving unknown quest data value %s", qUtf8Printable(error));
 }
 
 void MHGUQuestEditor::saveQuestInfoFromUi()
@@ -1780,117 +1657,46 @@ void MHGUQuestEditor::saveQuestInfoFromUi()
         if (language >= gmds.size() || !ui.tabWidgetLanguage->isTabEnabled(language))
             continue;
         auto& gmd = gmds[language];
-        const auto tab = ui.tabWidgetLanguage->widget(language);
-        const auto languageName = Resources::Language::toString(language, true);
-
-        const auto textName = tab->findChild<QLineEdit*>("textName" + languageName);
-        const auto textClient = tab->findChild<QLineEdit*>("textClient" + languageName);
-        const auto textDescription = tab->findChild<QPlainTextEdit*>("textDescription" + languageName);
-        const auto textZako = tab->findChild<QPlainTextEdit*>("textZako" + languageName);
-        const auto textObjective = tab->findChild<QPlainTextEdit*>("textObjective" + languageName);
-        const auto textFailure = tab->findChild<QPlainTextEdit*>("textFailure" + languageName);
-        const auto textSubquest = tab->findChild<QLineEdit*>("textSubquest" + languageName);
-
-        gmd.Entries[0] = textName->text().toStdString();
-        gmd.Entries[1] = textClient->text().toStdString();
-        gmd.Entries[2] = textDescription->toPlainText().replace("\n", "\r\n").toStdString();
-        gmd.Entries[3] = textZako->toPlainText().replace("\n", "\r\n").toStdString();
-        gmd.Entries[4] = textObjective->toPlainText().replace("\n", "\r\n").toStdString();
-        gmd.Entries[5] = textFailure->toPlainText().replace("\n", "\r\n").toStdString();
-        gmd.Entries[6] = textSubquest->text().toStdString();
+        const auto& widgets = questTextWidgets[language];
+
+        gmd.setEntry(0, widgets.Name->text());
+        gmd.setEntry(1, widgets.Client->text());
+        gmd.setEntry(2, widgets.Description->toPlainText().replace("\n", "\r\n"));
+        gmd.setEntry(3, widgets.Zako->toPlainText().replace("\n", "\r\n"));
+        gmd.setEntry(4, widgets.Objective->toPlainText().replace("\n", "\r\n"));
+        gmd.setEntry(5, widgets.Failure->toPlainText().replace("\n", "\r\n"));
+        gmd.setEntry(6, widgets.Subquest->text());
     }
 }
 
-void MHGUQuestEditor::saveRemFromUi(Resources::Rem& rem, const QString& remName, s32 tabIndex)
+void MHGUQuestEditor::saveRemFromUi(Resources::Rem& rem, s32 tabIndex)
 {
-    const auto tab = ui.tabWidgetRewards->widget(tabIndex);
+    // Only the flags are read back, the reward table edits the rewards in place
+    const auto& widgets = remFlagWidgets[tabIndex];
 
     for (s32 i = 0; i < 8; ++i)
     {
-        rem.Flags[i].Flag = (u8)tab->findChild<QSpinBox*>(QStringLiteral("spinBoxRem%1Flag%2").arg(remName).arg(i))->value();
-        rem.Flags[i].Value = (u8)tab->findChild<QSpinBox*>(QStringLiteral("spinBoxRem%1Value%2").arg(remName).arg(i))->value();
+        rem.Flags[i].Flag = (u8)widgets.Flags[i]->value();
+        rem.Flags[i].Value = (u8)widgets.Values[i]->value();
     }
-
-    const auto scrollArea = tab->findChild<QScrollArea*>(QStringLiteral("scrollAreaRem%1").arg(remName));
-    const auto layout = (QVBoxLayout*)scrollArea->widget()->layout();
-
-    std::memset(rem.Rewards, 0, sizeof(rem.Rewards));
-
-    s32 i;
-    for (i = 0; i < layout->count(); ++i)
-    {
-        const auto itemLayout = (QHBoxLayout*)layout->itemAt(i)->layout();
-        const auto itemCombo = (QComboBox*)itemLayout->itemAt(1)->widget();
-        const auto amountBox = (QSpinBox*)itemLayout->itemAt(2)->widget();
-        const auto chanceBox = (QSpinBox*)itemLayout->itemAt(3)->widget();
-        rem.Rewards[i].ItemId = itemCombo->currentIndex();
-        rem.Rewards[i].Amount = amountBox->value();
-        rem.Rewards[i].Weight = chanceBox->value();
-    }
-
-    if (i != 0 && i < std::size(rem.Rewards))
-        rem.Rewards[i] = { .Weight = 255 }; // End marker
 }
 
-void MHGUQuestEditor::loadRemIntoUi(const Resources::Rem& rem, const QString& remName, s32 tabIndex)
+void MHGUQuestEditor::loadRemIntoUi(Resources::Rem& rem, s32 tabIndex)
 {
-    const auto tab = ui.tabWidgetRewards->widget(tabIndex);
+    const auto& widgets = remFlagWidgets[tabIndex];
 
     for (s32 i = 0; i < 8; ++i)
     {
-        tab->findChild<QSpinBox*>(QStringLiteral("spinBoxRem%1Flag%2").arg(remName).arg(i))->setValue(rem.Flags[i].Flag);
-        tab->findChild<QSpinBox*>(QStringLiteral("spinBoxRem%1Value%2").arg(remName).arg(i))->setValue(rem.Flags[i].Value);
-    }
-
-    const auto scrollArea = tab->findChild<QScrollArea*>(QStringLiteral("scrollAreaRem%1").arg(remName));
-    const auto container = new QWidget;
-    scrollArea->setWidget(container);
-    const auto layout = new QVBoxLayout(container);
-
-    if (*(const u32*)&rem.Rewards[0] == 0) // Empty rewards
-        return;
-
-    scrollArea->setUpdatesEnabled(false);
-
-    for (const auto [i, item] : std::views::enumerate(rem.Rewards)) {
-        if (item.ItemId == 0 && item.Amount == 0 && item.Weight == 255) // End marker
-            break;
-
-        const auto deleteButton = new QToolButton;
-        const auto itemCombo = new QComboBox;
-        const auto amountBox = new QSpinBox;
-        const auto chanceBox = new QSpinBox;
-        const auto itemLayout = new QHBoxLayout;
-        
-        itemCombo->setModel(ItemNamesModel);
-        chanceBox->setSuffix("%");
-        
-        deleteButton->setText("⨯");
-        connect(deleteButton, &QToolButton::clicked, [itemLayout] {
-            itemLayout->itemAt(0)->widget()->deleteLater(); // Delete button
-            itemLayout->itemAt(1)->widget()->deleteLater(); // Item combo
-            itemLayout->itemAt(2)->widget()->deleteLater(); // Amount box
-            itemLayout->itemAt(3)->widget()->deleteLater(); // Chance box
-            itemLayout->deleteLater();
-        });
-
-        itemCombo->setCurrentIndex(item.ItemId);
-        amountBox->setValue(item.Amount);
-        chanceBox->setValue(item.Weight);
-
-        itemLayout->addWidget(deleteButton, 0);
-        itemLayout->addWidget(itemCombo, 2);
-        itemLayout->addWidget(amountBox, 1);
-        itemLayout->addWidget(chanceBox, 1);
-        layout->addLayout(itemLayout);
+        widgets.Flags[i]->setValue(rem.Flags[i].Flag);
+        widgets.Values[i]->setValue(rem.Flags[i].Value);
     }
 
-    scrollArea->setUpdatesEnabled(true);
+    rewardModels[tabIndex]->setRem(&rem);
 }
 
 void MHGUQuestEditor::openSettings()
 {
-    const auto settings = new SettingsDialog(this, questListPath, autoUpdateQuestList);
+    const auto settings = new SettingsDialog(this, questListPath, autoUpdateQuestList, compressionPreset);
     settings->exec();
 
     if (settings->result() == QDialog::Accepted)
@@ -1898,6 +1704,7 @@ void MHGUQuestEditor::openSettings()
         qDebug("Settings updated");
         questListPath = settings->getQuestListPath();
         autoUpdateQuestList = settings->getAutoUpdateQuestList();
+        compressionPreset = settings->getCompressionPreset();
         saveSettings();
     }
 }
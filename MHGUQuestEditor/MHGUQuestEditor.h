@@ -1,9 +1,11 @@
 #pragma once
 
 #include <map>
-#include <QStringListModel>
+#include <QFutureWatcher>
 #include <QtWidgets/QMainWindow>
 #include "ui_MHGUQuestEditor.h"
+#include "Models/IconAtlas.h"
+#include "Models/LookupModel.h"
 #include "Widgets/EmSetListEditor/EmSetListEditor.h"
 #include "Widgets/BossSetEditor/BossSetEditor.h"
 #include "Widgets/AcEquipEditor/AcEquipEditor.h"
@@ -11,14 +13,21 @@
 #include "Resources/Gmd.h"
 #include "Resources/QuestArc.h"
 #include "Resources/QuestData.h"
+#include "Resources/QuestDataFields.h"
 #include "Resources/QuestLink.h"
+#include "Resources/QuestSnapshot.h"
 #include "Resources/Rem.h"
+#include "Resources/StatTable.h"
 
+class QProgressBar;
+class RewardTableModel;
 
 class MHGUQuestEditor : public QMainWindow
 {
     Q_OBJECT
 
+    friend class EditorBench; // Times the private load steps, see Bench/EditorBench.cpp
+
 public:
     MHGUQuestEditor(QWidget *parent = nullptr);
     ~MHGUQuestEditor();
@@ -30,24 +39,28 @@ protected:
     void closeEvent(QCloseEvent* event) override;
 
 private:
-    void initIconDropdowns();
-    void initStatDropdowns();
+    void bindWidgets();
+    void initIconDropdowns(IconAtlas icons);
+    void initStatDropdowns(const Resources::StatTable& table);
     void initMonsterDropdowns();
-    void initQuestTypeDropdown() const;
-    void initQuestSubTypeDropdown() const;
-    void initQuestLevelDropdown() const;
-    void initMonsterLevelDropdown() const;
+    void initQuestTypeDropdown();
+    void initQuestSubTypeDropdown();
+    void initQuestLevelDropdown();
+    void initMonsterLevelDropdown();
     void initMapDropdown();
-    void initSpawnTypeDropdown() const;
-    void initBgmDropdown() const;
-    void initRequirementsDropdowns() const;
-    void initClearTypeDropdown() const;
-    void initObjectiveDropdowns() const;
-    void initItemLevelDropdowns() const;
-    void initItemNames();
+    void initSpawnTypeDropdown();
+    void initBgmDropdown();
+    void initRequirementsDropdowns();
+    void initClearTypeDropdown();
+    void initObjectiveDropdowns();
+    void initItemLevelDropdowns();
+    void initItemNames(std::vector<LookupModel::Entry> names);
     void initSpawns();
 
-    void addRemEntry(const QString& remName, s32 tabIndex);
+    AcEquipEditor* getAcEquipEditor();
+
+    void initRewardTables();
+    void addRemEntry(s32 tabIndex);
 
     void loadSettings();
     void saveSettings() const;
@@ -57,21 +70,75 @@ private:
     void onSaveFileAs();
 
     void loadFile(const QString& path);
-    void loadQuestArc();
+    void loadQuestArc(const QString& path);
+    void onQuestArcLoaded();
+    void bindQuestSnapshot(Resources::QuestSnapshot& snapshot);
+    void setOpenedFile(const QString& path);
     void saveQuestArc(const QString& path = {});
     void saveQuestFile(const QString& path = {}) const;
-    void saveQuestArcToQuestList() const;
+    void saveQuestArcToQuestList();
+    void compactQuestList();
+    void syncQuestFolderToQuestList();
     void saveAcEquip();
     void loadQuestDataIntoUi();
-    void loadRemIntoUi(const Resources::Rem& rem, const QString& remName, s32 tabIndex);
+    void loadRemIntoUi(Resources::Rem& rem, s32 tabIndex);
     void saveQuestDataFromUi();
     void saveQuestInfoFromUi();
-    void saveRemFromUi(Resources::Rem& rem, const QString& remName, s32 tabIndex);
+    void saveRemFromUi(Resources::Rem& rem, s32 tabIndex);
 
     void openSettings();
 
 private:
+    // Widgets that exist once per language, rem or large monster, and the spin boxes of
+    // plain quest data fields. Resolved from the binding tables in MHGUQuestEditor.cpp right after setupUi.
+    struct QuestTextWidgets
+    {
+        QLineEdit* Name;
+        QLineEdit* Client;
+        QPlainTextEdit* Description;
+        QPlainTextEdit* Zako;
+        QPlainTextEdit* Objective;
+        QPlainTextEdit* Failure;
+        QLineEdit* Subquest;
+    };
+
+    struct RemFlagWidgets
+    {
+        std::array<QSpinBox*, 8> Flags;
+        std::array<QSpinBox*, 8> Values;
+    };
+
+    struct MonsterWidgets
+    {
+        QComboBox* Monster;
+        QComboBox* Health;
+        QComboBox* Attack;
+        QComboBox* Defense;
+        QComboBox* Other;
+        QSpinBox* Special;
+        QSpinBox* State;
+        QSpinBox* RestoreAmount;
+        QSpinBox* Difficulty;
+        QSpinBox* Size;
+        QSpinBox* SizeTable;
+        QSpinBox* StaminaTable;
+        QSpinBox* SpawnType;
+        QSpinBox* SpawnTargetType;
+        QSpinBox* SpawnTargetAmount;
+        QLabel* Hp;
+    };
+
+    struct QuestFieldWidget
+    {
+        QSpinBox* SpinBox;
+        Resources::QuestFieldRef Field;
+    };
+
     Ui::MHGUQuestEditorClass ui;
+    std::array<QuestTextWidgets, Resources::Language::Count> questTextWidgets;
+    std::array<RemFlagWidgets, 5> remFlagWidgets;
+    std::array<MonsterWidgets, 5> monsterWidgets;
+    std::vector<QuestFieldWidget> questFieldWidgets;
 
     QString openedFile;
     std::unique_ptr<Resources::QuestArc> arc;
@@ -79,11 +146,19 @@ private:
     std::vector<Resources::Rem> rems;
     std::unique_ptr<Resources::QuestLink> questLink;
     Resources::QuestData questData;
-    std::vector<QPixmap> monsterIcons;
+    IconAtlas monsterIcons;
+    LookupModel* monsterModel = nullptr;
     std::array<EmSetListEditor*, 3> emSetListEditors;
     std::array<BossSetEditor*, 5> bossSetEditors;
+    std::array<RewardTableModel*, 5> rewardModels;
+
+    // Quest arcs are parsed on a worker thread, the UI is only updated once the whole quest is ready
+    QFutureWatcher<std::shared_ptr<Resources::QuestSnapshot>> questLoadWatcher;
+    QString loadingFile;
+    QProgressBar* loadProgress;
+    QPushButton* cancelLoadButton;
 
-    AcEquipEditor* acEquipEditor;
+    AcEquipEditor* acEquipEditor = nullptr;
     QString acEquipPath;
     std::unique_ptr<Resources::Arc> acEquipArc;
     
@@ -93,6 +168,7 @@ private:
 
     QString questListPath;
     bool autoUpdateQuestList;
+    Resources::CompressionPolicy::Preset compressionPreset = Resources::CompressionPolicy::Preset::Default;
     QStringList recentFiles;
     constexpr static int maxRecentFiles = 10;
     QMenu* recentFilesMenu;
@@ -100,6 +176,5 @@ private:
     const QString acEquipArcPath = QStringLiteral(R"(quest\ac_equip\ac_pl_equip)");
 
 public:
-    static inline QStringList ItemNames;
-    static inline QStringListModel* ItemNamesModel;
+    static inline LookupModel* ItemNamesModel;
 };
@@ -0,0 +1,202 @@
+#include "EquipSetModels.h"
+#include "LookupModel.h"
+
+#include <algorithm>
+
+
+namespace
+{
+
+QVariant lookupName(const LookupModel* model, int value)
+{
+    const auto row = model->rowOf(value);
+    return row < 0 ? QVariant() : QVariant(model->entry(row).Name);
+}
+
+}
+
+ArmorTableModel::ArmorTableModel(std::array<LookupModel*, PieceCount> armorNames, LookupModel* decorationNames,
+    MaxLevelFunction maxLevel, QObject* parent)
+    : QAbstractTableModel(parent), armors(armorNames), decorations(decorationNames), maxLevelOf(std::move(maxLevel))
+{
+}
+
+void ArmorTableModel::setEquipSet(Resources::EquipSet* set)
+{
+    beginResetModel();
+    equipSet = set;
+    endResetModel();
+}
+
+int ArmorTableModel::maxLevel(int piece) const
+{
+    return equipSet ? maxLevelOf(equipSet->Equipment[piece].Id) : 1;
+}
+
+int ArmorTableModel::rowCount(const QModelIndex& parent) const
+{
+    return parent.isValid() || !equipSet ? 0 : PieceCount;
+}
+
+int ArmorTableModel::columnCount(const QModelIndex& parent) const
+{
+    return parent.isValid() ? 0 : ColumnCount;
+}
+
+QVariant ArmorTableModel::data(const QModelIndex& index, int role) const
+{
+    static constexpr std::array pieces = { "Head", "Chest", "Arms", "Waist", "Legs" };
+
+    if (!equipSet || !index.isValid() || (role != Qt::DisplayRole && role != Qt::EditRole))
+        return {};
+
+    const auto& piece = equipSet->Equipment[index.row()];
+    const auto display = role == Qt::DisplayRole;
+
+    switch (index.column())
+    {
+    case Piece:
+        return display ? QVariant(pieces[index.row()]) : QVariant();
+    case Armor:
+        return display ? lookupName(armors[index.row()], piece.Id) : QVariant(piece.Id);
+    case Level:
+        return piece.Level;
+    case Deco1: [[fallthrough]];
+    case Deco2: [[fallthrough]];
+    case Deco3:
+    {
+        const auto deco = piece.Decos[index.column() - Deco1];
+        return display ? lookupName(decorations, deco) : QVariant(deco);
+    }
+    default:
+        return {};
+    }
+}
+
+bool ArmorTableModel::setData(const QModelIndex& index, const QVariant& value, int role)
+{
+    if (!equipSet || !index.isValid() || role != Qt::EditRole)
+        return false;
+
+    auto& piece = equipSet->Equipment[index.row()];
+
+    switch (index.column())
+    {
+    case Armor:
+    {
+        piece.Id = (u16)value.toInt();
+
+        // A different armor can have a lower max level
+        piece.Level = (u8)std::clamp<int>(piece.Level, 1, maxLevelOf(piece.Id));
+        emit dataChanged(index, index.siblingAtColumn(Level));
+        return true;
+    }
+    case Level:
+        piece.Level = (u8)value.toInt();
+        break;
+    case Deco1: [[fallthrough]];
+    case Deco2: [[fallthrough]];
+    case Deco3:
+        piece.Decos[index.column() - Deco1] = (u16)value.toInt();
+        break;
+    default:
+        return false;
+    }
+
+    emit dataChanged(index, index);
+    return true;
+}
+
+QVariant ArmorTableModel::headerData(int section, Qt::Orientation orientation, int role) const
+{
+    static constexpr std::array columns = { "Piece", "Armor", "Level", "Deco 1", "Deco 2", "Deco 3" };
+
+    if (orientation != Qt::Horizontal || role != Qt::DisplayRole || section < 0 || section >= ColumnCount)
+        return QAbstractTableModel::headerData(section, orientation, role);
+
+    return columns[section];
+}
+
+Qt::ItemFlags ArmorTableModel::flags(const QModelIndex& index) const
+{
+    const auto flags = QAbstractTableModel::flags(index);
+    return index.column() == Piece ? flags : flags | Qt::ItemIsEditable;
+}
+
+EquipItemTableModel::EquipItemTableModel(LookupModel* itemNames, QObject* parent)
+    : QAbstractTableModel(parent), items(itemNames)
+{
+}
+
+void EquipItemTableModel::setEquipSet(Resources::EquipSet* set)
+{
+    beginResetModel();
+    equipSet = set;
+    endResetModel();
+}
+
+int EquipItemTableModel::rowCount(const QModelIndex& parent) const
+{
+    return parent.isValid() || !equipSet ? 0 : (int)std::size(equipSet->Items);
+}
+
+int EquipItemTableModel::columnCount(const QModelIndex& parent) const
+{
+    return parent.isValid() ? 0 : ColumnCount;
+}
+
+QVariant EquipItemTableModel::data(const QModelIndex& index, int role) const
+{
+    if (!equipSet || !index.isValid() || (role != Qt::DisplayRole && role != Qt::EditRole))
+        return {};
+
+    const auto& item = equipSet->Items[index.row()];
+
+    switch (index.column())
+    {
+    case Item:
+        return role == Qt::DisplayRole ? lookupName(items, item.Id) : QVariant(item.Id);
+    case Count:
+        return item.Count;
+    default:
+        return {};
+    }
+}
+
+bool EquipItemTableModel::setData(const QModelIndex& index, const QVariant& value, int role)
+{
+    if (!equipSet || !index.isValid() || role != Qt::EditRole)
+        return false;
+
+    auto& item = equipSet->Items[index.row()];
+
+    switch (index.column())
+    {
+    case Item:
+        item.Id = (u16)value.toInt();
+        break;
+    case Count:
+        item.Count = (u8)value.toInt();
+        break;
+    default:
+        return false;
+    }
+
+    emit dataChanged(index, index);
+    return true;
+}
+
+QVariant EquipItemTableModel::headerData(int section, Qt::Orientation orientation, int role) const
+{
+    static constexpr std::array columns = { "Item", "Amount" };
+
+    if (orientation != Qt::Horizontal || role != Qt::DisplayRole || section < 0 || section >= ColumnCount)
+        return QAbstractTableModel::headerData(section, orientation, role);
+
+    return columns[section];
+}
+
+Qt::ItemFlags EquipItemTableModel::flags(const QModelIndex& index) const
+{
+    return QAbstractTableModel::flags(index) | Qt::ItemIsEditable;
+}
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <QAbstractTableModel>
+
+#include <array>
+#include <functional>
+
+#include "Resources/AcEquip.h"
+
+class LookupModel;
+
+
+// The armor pieces of an equip set, one row per piece. Ids are edited through Qt::EditRole,
+// Qt::DisplayRole shows the names from the lookup models.
+class ArmorTableModel final : public QAbstractTableModel
+{
+    Q_OBJECT
+
+public:
+    enum Column
+    {
+        Piece,
+        Armor,
+        Level,
+        Deco1,
+        Deco2,
+        Deco3,
+        ColumnCount
+    };
+
+    static constexpr int PieceCount = 5; // The charm is edited separately
+
+    using MaxLevelFunction = std::function<int(int armorId)>;
+
+    ArmorTableModel(std::array<LookupModel*, PieceCount> armorNames, LookupModel* decorationNames,
+        MaxLevelFunction maxLevel, QObject* parent = nullptr);
+
+    void setEquipSet(Resources::EquipSet* set);
+
+    LookupModel* armorNames(int piece) const { return armors[piece]; }
+    int maxLevel(int piece) const;
+
+    int rowCount(const QModelIndex& parent = {}) const override;
+    int columnCount(const QModelIndex& parent = {}) const override;
+    QVariant data(const QModelIndex& index, int role = Qt::DisplayRole) const override;
+    bool setData(const QModelIndex& index, const QVariant& value, int role = Qt::EditRole) override;
+    QVariant headerData(int section, Qt::Orientation orientation, int role = Qt::DisplayRole) const override;
+    Qt::ItemFlags flags(const QModelIndex& index) const override;
+
+private:
+    Resources::EquipSet* equipSet = nullptr;
+    std::array<LookupModel*, PieceCount> armors;
+    LookupModel* decorations;
+    MaxLevelFunction maxLevelOf;
+};
+
+// The item pouch of an equip set, one row per slot
+class EquipItemTableModel final : public QAbstractTableModel
+{
+    Q_OBJECT
+
+public:
+    enum Column
+    {
+        Item,
+        Count,
+        ColumnCount
+    };
+
+    explicit EquipItemTableModel(LookupModel* itemNames, QObject* parent = nullptr);
+
+    void setEquipSet(Resources::EquipSet* set);
+
+    int rowCount(const QModelIndex& parent = {}) const override;
+    int columnCount(const QModelIndex& parent = {}) const override;
+    QVariant data(const QModelIndex& index, int role = Qt::DisplayRole) const override;
+    bool setData(const QModelIndex& index, const QVariant& value, int role = Qt::EditRole) override;
+    QVariant headerData(int section, Qt::Orientation orientation, int role = Qt::DisplayRole) const override;
+    Qt::ItemFlags flags(const QModelIndex& index) const override;
+
+private:
+    Resources::EquipSet* equipSet = nullptr;
+    LookupModel* items;
+};
@@ -0,0 +1,54 @@
+#include "IconAtlas.h"
+
+#include <iterator>
+
+
+IconAtlas IconAtlas::load()
+{
+    constexpr int iconSize = 70;
+    constexpr int offsetX = 1;
+    constexpr int offsetY = 1;
+    constexpr int gap = 2;
+    constexpr int columns = 7;
+    constexpr int rows = 14;
+
+    const QImage sheets[] = {
+        QImage(":/res/cmn_micon00.png"),
+        QImage(":/res/cmn_micon01.png")
+    };
+
+    // The first sheet is full, the second one ends after the first icon of its 7th row
+    const int sheetIcons[] = { columns * rows, columns * 6 + 1 };
+
+    IconAtlas atlas;
+    atlas.images.reserve(sheetIcons[0] + sheetIcons[1]);
+
+    for (size_t sheet = 0; sheet < std::size(sheets); sheet++)
+    {
+        for (int i = 0; i < sheetIcons[sheet]; i++)
+        {
+            const int xPos = (i % columns) * (iconSize + gap) + offsetX;
+            const int yPos = (i / columns) * (iconSize + gap) + offsetY;
+            atlas.images.push_back(sheets[sheet].copy(xPos, yPos, iconSize, iconSize));
+        }
+    }
+
+    atlas.pixmaps.resize(atlas.images.size());
+    return atlas;
+}
+
+const QPixmap& IconAtlas::pixmap(size_t index) const
+{
+    static const QPixmap empty;
+    if (index >= images.size())
+        return empty;
+
+    auto& pixmap = pixmaps[index];
+    if (pixmap.isNull())
+    {
+        pixmap = QPixmap::fromImage(std::move(images[index]));
+        images[index] = QImage();
+    }
+
+    return pixmap;
+}
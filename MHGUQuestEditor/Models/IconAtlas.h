@@ -0,0 +1,25 @@
+#pragma once
+
+#include <QImage>
+#include <QPixmap>
+
+#include <vector>
+
+
+// Quest icons, cut out of the icon sheets when loading. A pixmap is only created the first
+// time an icon is asked for, after that every user shares that one pixmap.
+class IconAtlas
+{
+public:
+    // Decodes the icon sheets and slices them into icons, safe to call from a worker thread
+    static IconAtlas load();
+
+    size_t size() const { return images.size(); }
+
+    // Pixmaps can only be created on the UI thread
+    const QPixmap& pixmap(size_t index) const;
+
+private:
+    mutable std::vector<QImage> images; // Released once the icon has its pixmap
+    mutable std::vector<QPixmap> pixmaps;
+};
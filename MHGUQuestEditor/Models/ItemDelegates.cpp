@@ -0,0 +1,72 @@
+#include "ItemDelegates.h"
+#include "LookupModel.h"
+
+#include <QAbstractItemView>
+#include <QComboBox>
+#include <QSpinBox>
+
+
+LookupDelegate::LookupDelegate(LookupFunction lookup, int popupWidth, QObject* parent)
+    : QStyledItemDelegate(parent), lookup(std::move(lookup)), popupWidth(popupWidth)
+{
+}
+
+QWidget* LookupDelegate::createEditor(QWidget* parent, const QStyleOptionViewItem&, const QModelIndex& index) const
+{
+    const auto combo = new QComboBox(parent);
+    combo->setModel(lookup(index));
+    combo->view()->setMinimumWidth(popupWidth);
+
+    // Picking an entry applies it right away instead of waiting for the editor to lose focus
+    const auto delegate = const_cast<LookupDelegate*>(this);
+    connect(combo, &QComboBox::activated, delegate, [delegate, combo] {
+        emit delegate->commitData(combo);
+        emit delegate->closeEditor(combo);
+    });
+
+    return combo;
+}
+
+void LookupDelegate::setEditorData(QWidget* editor, const QModelIndex& index) const
+{
+    const auto combo = static_cast<QComboBox*>(editor);
+    combo->setCurrentIndex(combo->findData(index.data(Qt::EditRole)));
+}
+
+void LookupDelegate::setModelData(QWidget* editor, QAbstractItemModel* model, const QModelIndex& index) const
+{
+    const auto combo = static_cast<QComboBox*>(editor);
+    if (combo->currentIndex() >= 0)
+        model->setData(index, combo->currentData(), Qt::EditRole);
+}
+
+SpinBoxDelegate::SpinBoxDelegate(int minimum, int maximum, QObject* parent)
+    : SpinBoxDelegate(minimum, [maximum](const QModelIndex&) { return maximum; }, parent)
+{
+}
+
+SpinBoxDelegate::SpinBoxDelegate(int minimum, MaximumFunction maximum, QObject* parent)
+    : QStyledItemDelegate(parent), minimum(minimum), maximum(std::move(maximum))
+{
+}
+
+QWidget* SpinBoxDelegate::createEditor(QWidget* parent, const QStyleOptionViewItem&, const QModelIndex& index) const
+{
+    const auto spinBox = new QSpinBox(parent);
+    spinBox->setFrame(false);
+    spinBox->setRange(minimum, maximum(index));
+    spinBox->setSuffix(suffix);
+    return spinBox;
+}
+
+void SpinBoxDelegate::setEditorData(QWidget* editor, const QModelIndex& index) const
+{
+    static_cast<QSpinBox*>(editor)->setValue(index.data(Qt::EditRole).toInt());
+}
+
+void SpinBoxDelegate::setModelData(QWidget* editor, QAbstractItemModel* model, const QModelIndex& index) const
+{
+    const auto spinBox = static_cast<QSpinBox*>(editor);
+    spinBox->interpretText();
+    model->setData(index, spinBox->value(), Qt::EditRole);
+}
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <QStyledItemDelegate>
+
+#include <functional>
+
+class LookupModel;
+
+
+// Edits a value through a combo box over a lookup model. The editor only exists while the cell
+// is being edited, the cell itself is painted from the table model's display text.
+class LookupDelegate final : public QStyledItemDelegate
+{
+    Q_OBJECT
+
+public:
+    using LookupFunction = std::function<LookupModel*(const QModelIndex&)>;
+
+    explicit LookupDelegate(LookupFunction lookup, int popupWidth = 0, QObject* parent = nullptr);
+
+    QWidget* createEditor(QWidget* parent, const QStyleOptionViewItem& option, const QModelIndex& index) const override;
+    void setEditorData(QWidget* editor, const QModelIndex& index) const override;
+    void setModelData(QWidget* editor, QAbstractItemModel* model, const QModelIndex& index) const override;
+
+private:
+    LookupFunction lookup;
+    int popupWidth;
+};
+
+// Edits an integer through a spin box whose maximum can depend on the rest of the row
+class SpinBoxDelegate final : public QStyledItemDelegate
+{
+    Q_OBJECT
+
+public:
+    using MaximumFunction = std::function<int(const QModelIndex&)>;
+
+    SpinBoxDelegate(int minimum, int maximum, QObject* parent = nullptr);
+    SpinBoxDelegate(int minimum, MaximumFunction maximum, QObject* parent = nullptr);
+
+    void setSuffix(const QString& suffix) { this->suffix = suffix; }
+
+    QWidget* createEditor(QWidget* parent, const QStyleOptionViewItem& option, const QModelIndex& index) const override;
+    void setEditorData(QWidget* editor, const QModelIndex& index) const override;
+    void setModelData(QWidget* editor, QAbstractItemModel* model, const QModelIndex& index) const override;
+
+private:
+    int minimum;
+    MaximumFunction maximum;
+    QString suffix;
+};
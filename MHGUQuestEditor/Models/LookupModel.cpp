@@ -0,0 +1,85 @@
+#include "LookupModel.h"
+
+
+LookupModel::LookupModel(std::vector<Entry> entries, QObject* parent)
+    : QAbstractListModel(parent), entries(std::move(entries))
+{
+    rows.reserve((qsizetype)this->entries.size());
+    for (int row = 0; row < (int)this->entries.size(); row++)
+    {
+        rows.try_emplace(this->entries[row].Value, row);
+    }
+}
+
+LookupModel* LookupModel::fromTable(const Resources::DataBundle::Table& table, QObject* parent)
+{
+    std::vector<Entry> entries;
+    entries.reserve(table.rows());
+
+    for (u32 i = 0; i < table.rows(); i++)
+    {
+        const auto value = table.columns() > 1 ? table.integer(i, 1) : (int)i;
+        entries.push_back({ table.text(i, 0), value, {} });
+    }
+
+    return new LookupModel(std::move(entries), parent);
+}
+
+int LookupModel::rowCount(const QModelIndex& parent) const
+{
+    return parent.isValid() ? 0 : (int)entries.size();
+}
+
+QVariant LookupModel::data(const QModelIndex& index, int role) const
+{
+    if (!index.isValid() || index.row() >= (int)entries.size())
+        return {};
+
+    const auto& entry = entries[index.row()];
+    switch (role)
+    {
+    case Qt::DisplayRole: [[fallthrough]];
+    case Qt::EditRole:
+        return entry.Name;
+    case Qt::DecorationRole:
+        return entry.Icon.isNull() ? QVariant() : QVariant(entry.Icon);
+    case Qt::UserRole:
+        return entry.Value;
+    default:
+        return {};
+    }
+}
+
+QModelIndexList LookupModel::match(const QModelIndex& start, int role, const QVariant& value, int hits, Qt::MatchFlags flags) const
+{
+    const auto isInteger = [](const QVariant& v) {
+        switch (v.typeId())
+        {
+        case QMetaType::Char: [[fallthrough]];
+        case QMetaType::SChar: [[fallthrough]];
+        case QMetaType::UChar: [[fallthrough]];
+        case QMetaType::Short: [[fallthrough]];
+        case QMetaType::UShort: [[fallthrough]];
+        case QMetaType::Int: [[fallthrough]];
+        case QMetaType::UInt: [[fallthrough]];
+        case QMetaType::LongLong: [[fallthrough]];
+        case QMetaType::ULongLong:
+            return true;
+        default:
+            return false;
+        }
+    };
+
+    bool ok = false;
+    const auto key = isInteger(value) ? value.toInt(&ok) : 0;
+
+    // Anything other than a single exact match on the value from the top falls back to a scan
+    if (!ok || role != Qt::UserRole || hits != 1 || start.row() != 0 || (flags & Qt::MatchTypeMask) != Qt::MatchExactly)
+        return QAbstractListModel::match(start, role, value, hits, flags);
+
+    const auto row = rowOf(key);
+    if (row < 0)
+        return {};
+
+    return { index(row) };
+}
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <QAbstractListModel>
+#include <QHash>
+#include <QIcon>
+
+#include <vector>
+
+#include "Resources/DataBundle.h"
+
+
+// Read-only list of named values, shared by every combo box that shows the same lookup table.
+// The value is exposed as Qt::UserRole, which is what QComboBox::currentData and findData use.
+class LookupModel final : public QAbstractListModel
+{
+    Q_OBJECT
+
+public:
+    struct Entry
+    {
+        QString Name;
+        int Value;
+        QIcon Icon;
+    };
+
+    explicit LookupModel(std::vector<Entry> entries, QObject* parent = nullptr);
+
+    // Single column tables use the row as the value, otherwise the second column holds it
+    static LookupModel* fromTable(const Resources::DataBundle::Table& table, QObject* parent = nullptr);
+
+    int rowCount(const QModelIndex& parent = {}) const override;
+    QVariant data(const QModelIndex& index, int role = Qt::DisplayRole) const override;
+
+    // Exact value lookups, which is what QComboBox::findData does, go through the value index
+    QModelIndexList match(const QModelIndex& start, int role, const QVariant& value, int hits = 1,
+        Qt::MatchFlags flags = Qt::MatchFlags(Qt::MatchStartsWith | Qt::MatchWrap)) const override;
+
+    const Entry& entry(int row) const { return entries[row]; }
+
+    // First row with the given value, or -1
+    int rowOf(int value) const { return rows.value(value, -1); }
+
+private:
+    std::vector<Entry> entries;
+    QHash<int, int> rows;
+};
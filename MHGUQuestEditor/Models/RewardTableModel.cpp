@@ -0,0 +1,163 @@
+#include "RewardTableModel.h"
+#include "LookupModel.h"
+
+#include <algorithm>
+#include <array>
+
+
+namespace
+{
+
+constexpr int MaxRewards = (int)std::size(Resources::Rem{}.Rewards);
+
+bool isEndMarker(const Resources::RewardEntry& entry)
+{
+    return entry.ItemId == 0 && entry.Amount == 0 && entry.Weight == 255;
+}
+
+}
+
+RewardTableModel::RewardTableModel(LookupModel* itemNames, QObject* parent)
+    : QAbstractTableModel(parent), items(itemNames)
+{
+}
+
+void RewardTableModel::setRem(Resources::Rem* rem)
+{
+    beginResetModel();
+
+    this->rem = rem;
+    rows = 0;
+
+    // An all zero first entry means there are no rewards at all
+    const auto& first = rem ? rem->Rewards[0] : Resources::RewardEntry{};
+    if (first.ItemId != 0 || first.Amount != 0 || first.Weight != 0)
+    {
+        while (rows < MaxRewards && !isEndMarker(rem->Rewards[rows]))
+            rows++;
+    }
+
+    endResetModel();
+}
+
+int RewardTableModel::rowCount(const QModelIndex& parent) const
+{
+    return parent.isValid() ? 0 : rows;
+}
+
+int RewardTableModel::columnCount(const QModelIndex& parent) const
+{
+    return parent.isValid() ? 0 : ColumnCount;
+}
+
+QVariant RewardTableModel::data(const QModelIndex& index, int role) const
+{
+    if (!rem || !index.isValid() || index.row() >= rows || (role != Qt::DisplayRole && role != Qt::EditRole))
+        return {};
+
+    const auto& entry = rem->Rewards[index.row()];
+    const auto display = role == Qt::DisplayRole;
+
+    switch (index.column())
+    {
+    case Item:
+    {
+        if (!display)
+            return entry.ItemId;
+
+        const auto row = items->rowOf(entry.ItemId);
+        return row < 0 ? QVariant() : QVariant(items->entry(row).Name);
+    }
+    case Amount:
+        return entry.Amount;
+    case Chance:
+        return display ? QVariant(QStringLiteral("%1%").arg(entry.Weight)) : QVariant(entry.Weight);
+    default:
+        return {};
+    }
+}
+
+bool RewardTableModel::setData(const QModelIndex& index, const QVariant& value, int role)
+{
+    if (!rem || !index.isValid() || index.row() >= rows || role != Qt::EditRole)
+        return false;
+
+    auto& entry = rem->Rewards[index.row()];
+
+    switch (index.column())
+    {
+    case Item:
+        entry.ItemId = (u16)value.toInt();
+        break;
+    case Amount:
+        entry.Amount = (u8)value.toInt();
+        break;
+    case Chance:
+        entry.Weight = (u8)value.toInt();
+        break;
+    default:
+        return false;
+    }
+
+    emit dataChanged(index, index);
+    return true;
+}
+
+QVariant RewardTableModel::headerData(int section, Qt::Orientation orientation, int role) const
+{
+    static constexpr std::array columns = { "Item", "Amount", "Chance" };
+
+    if (orientation != Qt::Horizontal || role != Qt::DisplayRole || section < 0 || section >= ColumnCount)
+        return QAbstractTableModel::headerData(section, orientation, role);
+
+    return columns[section];
+}
+
+Qt::ItemFlags RewardTableModel::flags(const QModelIndex& index) const
+{
+    return QAbstractTableModel::flags(index) | Qt::ItemIsEditable;
+}
+
+bool RewardTableModel::insertRows(int row, int count, const QModelIndex& parent)
+{
+    if (!rem || parent.isValid() || row < 0 || row > rows || count <= 0 || rows + count > MaxRewards)
+        return false;
+
+    beginInsertRows(parent, row, row + count - 1);
+
+    auto& rewards = rem->Rewards;
+    std::move_backward(rewards + row, rewards + rows, rewards + rows + count);
+    std::fill_n(rewards + row, count, Resources::RewardEntry{});
+    rows += count;
+    writeEndMarker();
+
+    endInsertRows();
+    return true;
+}
+
+bool RewardTableModel::removeRows(int row, int count, const QModelIndex& parent)
+{
+    if (!rem || parent.isValid() || row < 0 || count <= 0 || row + count > rows)
+        return false;
+
+    beginRemoveRows(parent, row, row + count - 1);
+
+    auto& rewards = rem->Rewards;
+    std::move(rewards + row + count, rewards + rows, rewards + row);
+    rows -= count;
+    writeEndMarker();
+
+    endRemoveRows();
+    return true;
+}
+
+void RewardTableModel::writeEndMarker()
+{
+    // Same layout the game uses: the entries, one end marker if there is room, zeros after that.
+    // A rem without any entries is all zeros.
+    auto& rewards = rem->Rewards;
+    std::fill(rewards + rows, rewards + MaxRewards, Resources::RewardEntry{});
+
+    if (rows != 0 && rows < MaxRewards)
+        rewards[rows] = { .Weight = 255 };
+}
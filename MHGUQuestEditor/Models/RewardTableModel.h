@@ -0,0 +1,46 @@
+#pragma once
+
+#include <QAbstractTableModel>
+
+#include "Resources/Rem.h"
+
+class LookupModel;
+
+
+// The rewards of a rem, edited in place. Rows are the entries before the end marker, which is
+// kept right after the last row so the rem can be serialized as is at any time.
+class RewardTableModel final : public QAbstractTableModel
+{
+    Q_OBJECT
+
+public:
+    enum Column
+    {
+        Item,
+        Amount,
+        Chance,
+        ColumnCount
+    };
+
+    explicit RewardTableModel(LookupModel* itemNames, QObject* parent = nullptr);
+
+    void setRem(Resources::Rem* rem);
+
+    int rowCount(const QModelIndex& parent = {}) const override;
+    int columnCount(const QModelIndex& parent = {}) const override;
+    QVariant data(const QModelIndex& index, int role = Qt::DisplayRole) const override;
+    bool setData(const QModelIndex& index, const QVariant& value, int role = Qt::EditRole) override;
+    QVariant headerData(int section, Qt::Orientation orientation, int role = Qt::DisplayRole) const override;
+    Qt::ItemFlags flags(const QModelIndex& index) const override;
+
+    // New rows are empty entries, no more than std::size(Rem::Rewards) rows fit
+    bool insertRows(int row, int count, const QModelIndex& parent = {}) override;
+    bool removeRows(int row, int count, const QModelIndex& parent = {}) override;
+
+private:
+    void writeEndMarker();
+
+    Resources::Rem* rem = nullptr;
+    LookupModel* items;
+    int rows = 0;
+};
@@ -1,50 +1,51 @@
 #include "AcEquip.h"
 
-#include <QDataStream>
+#include "Util/SpanReader.h"
+#include "Util/SpanWriter.h"
+
+#include <cstring>
 
 
 std::shared_ptr<Resources::AcEquip> Resources::AcEquip::deserialize(const QByteArray& data)
 {
-    QDataStream stream(data);
-    stream.setByteOrder(QDataStream::LittleEndian);
+    return deserialize(std::span((const u8*)data.data(), (size_t)data.size()));
+}
 
-    u32 version;
-    stream >> version;
+std::shared_ptr<Resources::AcEquip> Resources::AcEquip::deserialize(std::span<const u8> data)
+{
+    Util::SpanReader reader(data);
 
+    const auto version = reader.read<u32>();
     if (version != Version) {
         qCritical("Invalid version %08X", version);
         return {};
     }
 
-    s32 count;
-    stream >> count;
+    const auto count = reader.read<s32>();
+    if (count < 0 || (size_t)count > reader.remaining() / sizeof(ArenaQuest)) {
+        qCritical("Invalid quest count %d", count);
+        return {};
+    }
 
     auto equip = std::make_shared<AcEquip>();
-    for (s32 i = 0; i < count; i++) {
-        auto& quest = equip->Quests.emplace_back();
-        stream.readRawData((char*)&quest, sizeof(ArenaQuest));
-    }
+    equip->Quests.resize(count);
 
-    return equip;
-}
+    const auto quests = reader.readBytes(count * sizeof(ArenaQuest));
+    if (!quests.empty())
+        std::memcpy(equip->Quests.data(), quests.data(), quests.size());
 
-std::shared_ptr<Resources::AcEquip> Resources::AcEquip::deserialize(std::span<const u8> data)
-{
-    return deserialize(QByteArray((const char*)data.data(), data.size()));
+    return equip;
 }
 
 QByteArray Resources::AcEquip::serialize(const AcEquip& acEquip)
 {
-    QByteArray data;
-    QDataStream stream(&data, QIODeviceBase::WriteOnly);
-    stream.setByteOrder(QDataStream::LittleEndian);
-
-    stream << Version;
-    stream << (s32)acEquip.Quests.size();
+    const auto questsSize = acEquip.Quests.size() * sizeof(ArenaQuest);
+    QByteArray data(sizeof(u32) + sizeof(s32) + questsSize, Qt::Uninitialized);
+    Util::SpanWriter writer(data);
 
-    for (const auto& quest : acEquip.Quests) {
-        stream.writeRawData((const char*)&quest, sizeof(ArenaQuest));
-    }
+    writer.write(Version);
+    writer.write((s32)acEquip.Quests.size());
+    writer.writeBytes({ (const u8*)acEquip.Quests.data(), questsSize });
 
     return data;
 }
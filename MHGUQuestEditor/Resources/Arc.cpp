@@ -4,8 +4,24 @@
 
 #include <QtAssert>
 #include <QtLogging>
-#include <QDataStream>
 #include <QFile>
+#include <QSaveFile>
+#include <QtConcurrent/QtConcurrentMap>
+
+#include <atomic>
+#include <algorithm>
+#include <cerrno>
+#include <climits>
+#include <cstring>
+#include <limits>
+#include <ranges>
+
+#if defined(Q_OS_UNIX)
+#include <sys/uio.h>
+#include <unistd.h>
+#elif defined(Q_OS_WIN)
+#include <io.h>
+#endif
 
 #include <zlib.h>
 
@@ -27,7 +43,143 @@ struct ArcEntryInternal
     u32 Offset;
 };
 
-Resources::Arc::Arc(std::filesystem::path path) : path(std::move(path))
+namespace
+{
+
+ArcEntryInternal makeTableEntry(const Resources::ArcEntry& entry, u32 offset)
+{
+    ArcEntryInternal internal = {
+        .TypeHash = entry.TypeHash,
+        .CompSize = entry.CompSize,
+        .RealSize = entry.RealSize,
+        .Quality = entry.Quality,
+        .Offset = offset
+    };
+
+    const auto entryPath = entry.Path.toUtf8();
+    const auto pathLen = std::min(sizeof(internal.Path), (size_t)entryPath.size());
+    std::memcpy(internal.Path, entryPath.data(), pathLen);
+    std::memset(internal.Path + pathLen, 0, sizeof(internal.Path) - pathLen);
+
+    return internal;
+}
+
+struct ArcLayout
+{
+    std::vector<u8> Table; // Header and file table, padded up to the first payload
+    std::vector<u32> Offsets;
+};
+
+ArcLayout computeLayout(std::span<const Resources::ArcEntry* const> sortedEntries, u32 alignment)
+{
+    const auto fileTableLength = sizeof(ArcHeader) + sortedEntries.size() * sizeof(ArcEntryInternal);
+    auto dataOffset = fileTableLength + (alignment - fileTableLength % alignment);
+
+    ArcLayout layout;
+    layout.Table.resize(dataOffset);
+    layout.Offsets.reserve(sortedEntries.size());
+
+    const ArcHeader header = {
+        .Magic = Resources::Arc::Magic,
+        .Version = Resources::Arc::Version,
+        .FileCount = (s16)sortedEntries.size(),
+        .Padding = 0
+    };
+
+    std::memcpy(layout.Table.data(), &header, sizeof(ArcHeader));
+    auto tableEntry = (ArcEntryInternal*)(layout.Table.data() + sizeof(ArcHeader));
+
+    for (const auto entry : sortedEntries)
+    {
+        const auto internal = makeTableEntry(*entry, (u32)dataOffset);
+        std::memcpy(tableEntry++, &internal, sizeof(ArcEntryInternal));
+
+        layout.Offsets.push_back((u32)dataOffset);
+        dataOffset += entry->CompSize;
+    }
+
+    return layout;
+}
+
+bool writeVectored(QFileDevice& file, std::span<const std::span<const u8>> buffers)
+{
+#ifdef Q_OS_UNIX
+    std::vector<iovec> vectors;
+    vectors.reserve(buffers.size());
+
+    for (const auto buffer : buffers)
+    {
+        if (!buffer.empty())
+            vectors.push_back({ .iov_base = (void*)buffer.data(), .iov_len = buffer.size() });
+    }
+
+#ifdef IOV_MAX
+    constexpr size_t maxVectors = IOV_MAX;
+#else
+    constexpr size_t maxVectors = 16;
+#endif
+
+    const auto fd = file.handle();
+    size_t index = 0;
+
+    while (index < vectors.size())
+    {
+        const auto count = (int)std::min(vectors.size() - index, maxVectors);
+        const auto written = ::writev(fd, vectors.data() + index, count);
+        if (written < 0)
+        {
+            if (errno == EINTR)
+                continue;
+
+            return false;
+        }
+
+        // Skip past everything that made it out, a short write can stop in the middle of a buffer
+        auto remaining = (size_t)written;
+        while (remaining > 0 && index < vectors.size())
+        {
+            auto& vector = vectors[index];
+            if (remaining >= vector.iov_len)
+            {
+                remaining -= vector.iov_len;
+                ++index;
+            }
+            else
+            {
+                vector.iov_base = (u8*)vector.iov_base + remaining;
+                vector.iov_len -= remaining;
+                remaining = 0;
+            }
+        }
+    }
+
+    return true;
+#else
+    for (const auto buffer : buffers)
+    {
+        if (file.write((const char*)buffer.data(), (qint64)buffer.size()) != (qint64)buffer.size())
+            return false;
+    }
+
+    return true;
+#endif
+}
+
+// Makes sure everything written so far is on disk before anything that depends on it is written
+bool syncFile(QFileDevice& file)
+{
+#if defined(Q_OS_UNIX)
+    return ::fsync(file.handle()) == 0;
+#elif defined(Q_OS_WIN)
+    return ::_commit(file.handle()) == 0;
+#else
+    return file.flush();
+#endif
+}
+
+}
+
+Resources::Arc::Arc(std::filesystem::path path, LoadMode mode) : path(std::move(path))
 {
     if (this->path.extension() != Arc::Extension)
     {
@@ -35,43 +187,52 @@ Resources::Arc::Arc(std::filesystem::path path) : path(std::move(path))
         return;
     }
 
-    load();
+    load(mode);
 }
 
-std::span<const Resources::ArcEntry> Resources::Arc::getEntries() const
+Resources::Arc Resources::Arc::create(std::filesystem::path path)
 {
-    return entries;
+    Arc arc;
+    arc.path = std::move(path);
+    return arc;
 }
 
-std::vector<Resources::ArcEntry>& Resources::Arc::getEntries()
+Resources::Arc::~Arc() = default;
+Resources::Arc::Arc(Arc&&) noexcept = default;
+Resources::Arc& Resources::Arc::operator=(Arc&&) noexcept = default;
+
+std::span<const Resources::ArcEntry> Resources::Arc::getEntries() const
 {
     return entries;
 }
 
 const Resources::ArcEntry* Resources::Arc::findEntry(QStringView path) const
 {
-    for (auto& entry : entries)
+    auto it = entryIndex.find(path);
+    if (it == entryIndex.end())
     {
-        if (entry.Path == path)
+        return nullptr;
+    }
+
+    // Entry references handed out by findEntry and getEntry allow changing the path directly, so make
+    // sure the index still points at the right one
+    if (it->second >= entries.size() || entries[it->second].Path != path)
+    {
+        rebuildIndex();
+
+        it = entryIndex.find(path);
+        if (it == entryIndex.end())
         {
-            return &entry;
+            return nullptr;
         }
     }
 
-    return nullptr;
+    return &entries[it->second];
 }
 
 Resources::ArcEntry* Resources::Arc::findEntry(QStringView path)
 {
-    for (auto& entry : entries)
-    {
-        if (entry.Path == path)
-        {
-            return &entry;
-        }
-    }
-
-    return nullptr;
+    return const_cast<ArcEntry*>(std::as_const(*this).findEntry(path));
 }
 
 const Resources::ArcEntry& Resources::Arc::getEntry(int index) const
@@ -96,7 +257,11 @@ Resources::ArcEntry& Resources::Arc::getEntry(int index)
 
 Resources::ArcEntry& Resources::Arc::addEntry(const QString& fpath, const QString& typeName, std::span<const u8> data, bool compressed, u32 realSize)
 {
-    const auto typeHash = type_hash(typeName.toLatin1());
+    return addEntry(fpath, type_hash(typeName.toLatin1()), data, compressed, realSize);
+}
+
+Resources::ArcEntry& Resources::Arc::addEntry(const QString& fpath, u32 typeHash, std::span<const u8> data, bool compressed, u32 realSize)
+{
     ArcEntry entry = {
         .Path = fpath,
         .TypeHash = typeHash,
@@ -108,8 +273,7 @@ Resources::ArcEntry& Resources::Arc::addEntry(const QString& fpath, const QStrin
     if (compressed && realSize != 0)
         entry.RealSize = realSize;
 
-    entries.push_back(entry);
-    return entries.back();
+    return insertEntry(std::move(entry));
 }
 
 Resources::ArcEntry& Resources::Arc::addEntry(const QString& fpath, const QString& typeName, const QByteArray& data, bool compressed, u32 realSize)
@@ -117,25 +281,120 @@ Resources::ArcEntry& Resources::Arc::addEntry(const QString& fpath, const QStrin
     return addEntry(fpath, typeName, { (const u8*)data.data(), (size_t)data.size() }, compressed, realSize);
 }
 
-void Resources::Arc::load()
+Resources::PayloadView Resources::Arc::getDataView(const ArcEntry& entry) const
 {
-    QFile file(path);
-    if (!file.open(QIODevice::ReadOnly))
+    if (entry.PendingData)
+    {
+        return PayloadView(entry.PendingData);
+    }
+
+    if (const auto cached = payloadCache.find(entry.Revision); !cached.empty() || entry.RealSize == 0)
+    {
+        return cached;
+    }
+
+    auto decompressed = entry.getData();
+    if (decompressed.empty())
+    {
+        return {};
+    }
+
+    return payloadCache.insert(entry.Revision, std::move(decompressed));
+}
+
+const Resources::PayloadCache::Stats& Resources::Arc::getCacheStats() const
+{
+    return payloadCache.getStats();
+}
+
+void Resources::Arc::setCacheCapacity(size_t bytes)
+{
+    payloadCache.setCapacity(bytes);
+}
+
+Resources::ArcEntry& Resources::Arc::copyRawEntry(const ArcEntry& source)
+{
+    return copyRawEntry(source, source.Path);
+}
+
+Resources::ArcEntry& Resources::Arc::copyRawEntry(const ArcEntry& source, const QString& path)
+{
+    auto target = findEntry(path);
+    if (!target)
+    {
+        target = &insertEntry({ .Path = path, .CompSize = 0, .RealSize = 0, .Quality = 0 });
+    }
+
+    target->TypeHash = source.TypeHash;
+    target->Extension = source.Extension;
+    target->CompSize = source.CompSize;
+    target->RealSize = source.RealSize;
+    target->Quality = source.Quality;
+    target->Storage = source.Storage;
+    target->RawData = source.RawData;
+    target->PendingData = source.PendingData;
+    target->Revision = ArcEntry::nextRevision();
+
+    return *target;
+}
+
+void Resources::Arc::renameEntry(ArcEntry& entry, const QString& newPath)
+{
+    if (entry.Path == newPath)
+        return;
+
+    const auto index = (size_t)(&entry - entries.data());
+    Q_ASSERT(index < entries.size());
+
+    const auto it = entryIndex.find(entry.Path);
+    if (it != entryIndex.end() && it->second == index)
+    {
+        entryIndex.erase(it);
+    }
+
+    entry.Path = newPath;
+    entryIndex.try_emplace(newPath, index);
+}
+
+Resources::ArcEntry& Resources::Arc::insertEntry(ArcEntry entry)
+{
+    entryIndex.try_emplace(entry.Path, entries.size());
+    return entries.emplace_back(std::move(entry));
+}
+
+void Resources::Arc::rebuildIndex() const
+{
+    entryIndex.clear();
+    entryIndex.reserve(entries.size());
+
+    for (size_t i = 0; i < entries.size(); i++)
+    {
+        entryIndex.try_emplace(entries[i].Path, i);
+    }
+}
+
+void Resources::Arc::load(LoadMode mode)
+{
+    auto file = std::make_shared<QFile>(path);
+    if (!file->open(QIODevice::ReadOnly))
     {
         qCritical("Failed to open file %s", path.string().c_str());
         return;
     }
 
-    QDataStream stream(&file);
-    stream.setByteOrder(QDataStream::LittleEndian);
-    if (stream.atEnd())
+    const auto fileSize = file->size();
+    if (fileSize == 0)
     {
         qCritical("File is empty %s", path.string().c_str());
         return;
     }
 
     ArcHeader header;
-    stream.readRawData((char*)&header, sizeof(ArcHeader));
+    if (file->read((char*)&header, sizeof(ArcHeader)) != sizeof(ArcHeader))
+    {
+        qCritical("Truncated header %s", path.string().c_str());
+        return;
+    }
 
     if (header.Magic != Arc::Magic)
     {
@@ -149,15 +408,40 @@ void Resources::Arc::load()
         return;
     }
 
-    entries.reserve(header.FileCount);
+    // Read the whole table of contents in one go instead of seeking back and forth per entry
+    std::vector<ArcEntryInternal> toc(std::max<s16>(header.FileCount, 0));
+    const auto tocSize = (qint64)(toc.size() * sizeof(ArcEntryInternal));
+    if (file->read((char*)toc.data(), tocSize) != tocSize)
+    {
+        qCritical("Truncated file table %s", path.string().c_str());
+        return;
+    }
 
-    for (auto i = 0; i < header.FileCount; i++)
+    const uchar* mapping = nullptr;
+    if (mode == LoadMode::Mapped)
     {
-        ArcEntryInternal entry;
-        stream.readRawData((char*)&entry, sizeof(ArcEntryInternal));
+        mapping = file->map(0, fileSize);
+        if (!mapping)
+        {
+            qWarning("Failed to map %s, falling back to reading it", path.string().c_str());
+        }
+    }
+
+    entries.reserve(toc.size());
+    diskEntries.reserve(toc.size());
+
+    for (const auto& entry : toc)
+    {
+        if ((qint64)entry.Offset + entry.CompSize > fileSize)
+        {
+            qCritical("Entry %s points outside of %s", entry.Path, path.string().c_str());
+            entries.clear();
+            diskEntries.clear();
+            return;
+        }
 
         ArcEntry arcEntry = {
-            .Path = QString::fromUtf8(entry.Path),
+            .Path = QString::fromUtf8(entry.Path, (qsizetype)strnlen(entry.Path, sizeof(entry.Path))),
             .TypeHash = entry.TypeHash,
             .Extension = ExtensionResolver::resolve(entry.TypeHash),
             .CompSize = entry.CompSize,
@@ -165,89 +449,293 @@ void Resources::Arc::load()
             .Quality = entry.Quality
         };
 
-        const auto pos = file.pos();
-        file.seek(entry.Offset);
-        arcEntry.Data.resize(entry.CompSize);
-        stream.readRawData((char*)arcEntry.Data.data(), entry.CompSize);
-        file.seek(pos);
+        if (mapping)
+        {
+            arcEntry.Storage = file;
+            arcEntry.RawData = { mapping + entry.Offset, entry.CompSize };
+        }
+        else
+        {
+            std::vector<u8> data(entry.CompSize);
+            file->seek(entry.Offset);
+            file->read((char*)data.data(), entry.CompSize);
+            arcEntry.setRawData(std::move(data));
+        }
+
+        diskEntries.push_back({
+            .Path = arcEntry.Path,
+            .Offset = entry.Offset,
+            .CompSize = entry.CompSize,
+            .Revision = arcEntry.Revision
+        });
+
+        entries.emplace_back(std::move(arcEntry));
+    }
+
+    diskSize = fileSize;
+    rebuildIndex();
+
+    if (mapping)
+    {
+        // The mapping stays valid for as long as the file object is alive, which entries share ownership of
+        mappedFile = std::move(file);
+    }
+}
+
+void Resources::Arc::detach()
+{
+    if (!mappedFile)
+        return;
 
-        entries.emplace_back(arcEntry);
+    for (auto& entry : entries)
+    {
+        if (entry.Storage == mappedFile)
+        {
+            entry.setRawData({ entry.RawData.begin(), entry.RawData.end() });
+        }
     }
+
+    mappedFile.reset();
 }
 
-void Resources::Arc::save(const std::filesystem::path& path)
+bool Resources::Arc::save(const std::filesystem::path& path)
 {
+#ifdef Q_OS_WIN
+    // Windows refuses to replace a file that is still mapped. Elsewhere the old mapping
+    // simply keeps the replaced file alive until we let go of it.
+    std::error_code ec;
+    if (mappedFile && (path.empty() || std::filesystem::equivalent(path, this->path, ec)))
+    {
+        detach();
+    }
+#endif
+
     if (!path.empty())
     {
         this->path = path;
     }
 
-    QFile file(this->path);
-    if (!file.open(QIODevice::WriteOnly))
+    if (!compressPendingEntries())
+    {
+        qCritical("Failed to compress entries of %s", this->path.string().c_str());
+        return false;
+    }
+
+    const auto sortedEntries = getSortedEntries();
+    const auto layout = computeLayout(sortedEntries, Arc::DataAlignment);
+
+    // Header, file table and every payload are handed to the OS in one go, straight from the entry buffers
+    std::vector<std::span<const u8>> buffers;
+    buffers.reserve(sortedEntries.size() + 1);
+    buffers.emplace_back(layout.Table);
+
+    for (const auto entry : sortedEntries)
+    {
+        buffers.push_back(entry->getRawData().first(entry->CompSize));
+    }
+
+    // Written to a temporary file first and renamed over the target once complete
+    QSaveFile file(QString::fromStdWString(this->path.wstring()));
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Unbuffered))
     {
         qCritical("Failed to open file %s", this->path.string().c_str());
-        return;
+        return false;
+    }
+
+    if (!writeVectored(file, buffers))
+    {
+        qCritical("Failed to write file %s", this->path.string().c_str());
+        file.cancelWriting();
+        return false;
+    }
+
+    if (!file.commit())
+    {
+        qCritical("Failed to commit file %s", this->path.string().c_str());
+        return false;
+    }
+
+    diskEntries.clear();
+    diskEntries.reserve(sortedEntries.size());
+    diskSize = (qint64)layout.Table.size();
+
+    for (const auto [i, entry] : std::views::enumerate(sortedEntries))
+    {
+        diskEntries.push_back({
+            .Path = entry->Path,
+            .Offset = layout.Offsets[i],
+            .CompSize = entry->CompSize,
+            .Revision = entry->Revision
+        });
+
+        diskSize += entry->CompSize;
     }
 
-    QDataStream stream(&file);
-    stream.setByteOrder(QDataStream::LittleEndian);
+    return true;
+}
 
+bool Resources::Arc::saveIncremental()
+{
     const auto sortedEntries = getSortedEntries();
 
-    stream << Arc::Magic;
-    stream << Arc::Version;
-    stream << (s16)sortedEntries.size();
-    stream << (u32)0;
+    // Anything that changes the shape of the file table needs a full rewrite
+    bool sameLayout = sortedEntries.size() == diskEntries.size();
+    for (size_t i = 0; sameLayout && i < sortedEntries.size(); i++)
+    {
+        sameLayout = sortedEntries[i]->Path == diskEntries[i].Path;
+    }
 
-    const auto fileTableLength = sizeof(ArcHeader) + sortedEntries.size() * sizeof(ArcEntryInternal);
-    auto dataOffset = fileTableLength + (Arc::DataAlignment - fileTableLength % Arc::DataAlignment);
+    QFile file(path);
+    if (!sameLayout || !file.open(QIODevice::ReadWrite | QIODevice::Unbuffered) || file.size() != diskSize)
+    {
+        file.close();
+        return save();
+    }
 
-    std::vector<qint64> offsets;
+    if (!compressPendingEntries())
+    {
+        qCritical("Failed to compress entries of %s", path.string().c_str());
+        return false;
+    }
 
-    for (const auto entry : sortedEntries)
+    // Modified payloads are always appended. Nothing the current file table or a mapping of the
+    // file refers to is overwritten, so the file stays valid until the table is replaced.
+    auto updatedEntries = diskEntries;
+    auto fileEnd = diskSize;
+    std::vector<std::span<const u8>> payloads;
+
+    for (const auto [i, entry] : std::views::enumerate(sortedEntries))
     {
-        ArcEntryInternal internal = {
-            .TypeHash = entry->TypeHash,
-            .CompSize = entry->CompSize,
-            .RealSize = entry->RealSize,
-            .Quality = entry->Quality,
-            .Offset = (u32)dataOffset
-        };
+        auto& disk = updatedEntries[i];
+        if (entry->Revision == disk.Revision)
+            continue;
+
+        if (fileEnd + entry->CompSize > std::numeric_limits<u32>::max())
+        {
+            // Offsets would no longer fit into the file table
+            file.close();
+            return save();
+        }
 
-        const auto entryPath = entry->Path.toUtf8();
-        const auto pathLen = std::min(sizeof(internal.Path), (size_t)entryPath.size());
-        std::memcpy(internal.Path, entryPath.data(), pathLen);
-        std::memset(internal.Path + pathLen, 0, sizeof(internal.Path) - pathLen);
+        payloads.push_back(entry->getRawData().first(entry->CompSize));
 
-        stream.writeRawData((const char*)&internal, sizeof(ArcEntryInternal));
+        disk.Offset = (u32)fileEnd;
+        disk.CompSize = entry->CompSize;
+        disk.Revision = entry->Revision;
+        fileEnd += entry->CompSize;
+    }
 
-        offsets.push_back(dataOffset);
-        dataOffset += entry->CompSize;
+    if (payloads.empty())
+        return true;
+
+    if (!file.seek(diskSize) || !writeVectored(file, payloads) || !syncFile(file))
+    {
+        qCritical("Failed to append entries to %s", path.string().c_str());
+        file.resize(diskSize);
+        return false;
+    }
+
+    // The file table is replaced in a single write once every payload it points at is on disk
+    std::vector<u8> table(sizeof(ArcHeader) + sortedEntries.size() * sizeof(ArcEntryInternal));
+    const ArcHeader header = {
+        .Magic = Arc::Magic,
+        .Version = Arc::Version,
+        .FileCount = (s16)sortedEntries.size(),
+        .Padding = 0
+    };
+
+    std::memcpy(table.data(), &header, sizeof(ArcHeader));
+    for (const auto [i, entry] : std::views::enumerate(sortedEntries))
+    {
+        const auto internal = makeTableEntry(*entry, updatedEntries[i].Offset);
+        std::memcpy(table.data() + sizeof(ArcHeader) + i * sizeof(ArcEntryInternal), &internal, sizeof(ArcEntryInternal));
+    }
+
+    if (!file.seek(0) || file.write((const char*)table.data(), (qint64)table.size()) != (qint64)table.size() || !syncFile(file))
+    {
+        qCritical("Failed to write file table of %s", path.string().c_str());
+        return false;
+    }
+
+    diskEntries = std::move(updatedEntries);
+    diskSize = fileEnd;
+    return true;
+}
+
+bool Resources::Arc::compact()
+{
+    return save();
+}
+
+void Resources::Arc::setCompressionPolicy(const CompressionPolicy& policy)
+{
+    compression = policy;
+}
+
+const Resources::CompressionPolicy& Resources::Arc::getCompressionPolicy() const
+{
+    return compression;
+}
+
+std::vector<u8> Resources::Arc::getCompressedData(const ArcEntry& entry) const
+{
+    return entry.getData(false, compression);
+}
+
+bool Resources::Arc::compressPendingEntries()
+{
+    std::vector<ArcEntry*> pending;
+    for (auto& entry : entries)
+    {
+        if (entry.PendingData)
+            pending.push_back(&entry);
     }
 
-    // Pad to 0x8000
-    const auto paddingSize = Arc::DataAlignment - file.pos() % Arc::DataAlignment;
-    constexpr char padding[Arc::DataAlignment] = {};
-    stream.writeRawData(padding, paddingSize);
+    std::atomic<bool> ok = true;
+    const auto compress = [this, &ok](ArcEntry* entry) {
+        if (!entry->compressPendingData(compression))
+        {
+            qCritical("Failed to compress entry %s", qUtf8Printable(entry->Path));
+            ok = false;
+        }
+    };
 
-    for (auto i = 0; i < sortedEntries.size(); i++)
+    if (pending.size() > 1)
     {
-        Q_ASSERT(file.pos() == offsets[i]);
-        stream.writeRawData((const char*)sortedEntries[i]->Data.data(), sortedEntries[i]->CompSize);
+        QtConcurrent::blockingMap(pending, compress);
     }
+    else if (!pending.empty())
+    {
+        compress(pending.front());
+    }
+
+    return ok;
+}
+
+std::span<const u8> Resources::ArcEntry::getRawData() const
+{
+    return RawData;
 }
 
-std::vector<u8> Resources::ArcEntry::getData(bool decompress) const
+std::vector<u8> Resources::ArcEntry::getData(bool decompress, const CompressionPolicy& policy) const
 {
+    if (PendingData)
+    {
+        // Not compressed yet, either hand out the data as is or compress a copy of it
+        return decompress ? *PendingData : compressData(*PendingData, policy);
+    }
+
+    const auto raw = getRawData();
+
     if (!decompress)
     {
-        return Data;
+        return { raw.begin(), raw.end() };
     }
 
     uLongf realSize = RealSize;
     std::vector<u8> decompressed(RealSize);
 
-    if (uncompress(decompressed.data(), &realSize, Data.data(), (uLong)Data.size()) != Z_OK)
+    if (uncompress(decompressed.data(), &realSize, raw.data(), (uLong)raw.size()) != Z_OK)
     {
         qCritical("Failed to decompress data");
         return {};
@@ -264,24 +752,21 @@ std::vector<u8> Resources::ArcEntry::getData(bool decompress) const
 
 void Resources::ArcEntry::setData(std::span<const u8> data, bool compress)
 {
+    Revision = nextRevision();
+
     if (!compress)
     {
-        Data = { std::from_range, data };
+        PendingData.reset();
+        setRawData({ std::from_range, data });
         CompSize = (u32)data.size();
         return;
     }
 
-    uLongf compSize = compressBound((uLong)data.size());
-    Data.resize(compSize);
-
-    if (::compress(Data.data(), &compSize, data.data(), (uLong)data.size()) != Z_OK)
-    {
-        qCritical("Failed to compress data");
-        return;
-    }
-
-    Data.resize(compSize);
-    CompSize = compSize;
+    // Compression is deferred until the arc is saved so that it can be batched
+    PendingData = std::make_shared<const std::vector<u8>>(std::from_range, data);
+    Storage.reset();
+    RawData = {};
+    CompSize = 0;
     RealSize = (u32)data.size();
 }
 
@@ -289,3 +774,37 @@ void Resources::ArcEntry::setData(const QByteArray& data, bool compress)
 {
     setData({ (const u8*)data.data(), (size_t)data.size() }, compress);
 }
+
+bool Resources::ArcEntry::compressPendingData(const CompressionPolicy& policy)
+{
+    if (!PendingData)
+        return true;
+
+    // A zlib stream is never empty, not even for empty input
+    auto compressed = compressData(*PendingData, policy);
+    if (compressed.empty())
+        return false;
+
+    setRawData(std::move(compressed));
+    CompSize = (u32)RawData.size();
+    PendingData.reset();
+    return true;
+}
+
+void Resources::ArcEntry::setRawData(std::vector<u8> data)
+{
+    const auto storage = std::make_shared<const std::vector<u8>>(std::move(data));
+    RawData = *storage;
+    Storage = storage;
+}
+
+std::vector<u8> Resources::ArcEntry::compressData(std::span<const u8> data, const CompressionPolicy& policy)
+{
+    return policy.compress(data);
+}
+
+u64 Resources::ArcEntry::nextRevision()
+{
+    static std::atomic<u64> revision = 0;
+    return ++revision;
+}
@@ -1,13 +1,20 @@
 #pragma once
 
 #include <Common.h>
+#include "Compression.h"
+#include "PayloadCache.h"
 
+#include <QHash>
 #include <QString>
 #include <filesystem>
+#include <memory>
 #include <optional>
+#include <unordered_map>
 #include <vector>
 #include <span>
 
+class QFile;
+
 
 namespace Resources
 {
@@ -20,11 +27,27 @@ struct ArcEntry
     u32 CompSize;
     u32 RealSize : 29;
     u32 Quality : 3;
-    std::vector<u8> Data;
-
-    std::vector<u8> getData(bool decompress = true) const;
+    // Compressed data. Storage keeps the memory RawData points into alive, which is either a buffer of
+    // the entry's own or a whole arc file mapping. Copies of an entry share it, even across arcs.
+    std::shared_ptr<const void> Storage;
+    std::span<const u8> RawData;
+    std::shared_ptr<const std::vector<u8>> PendingData; // Uncompressed data waiting to be compressed by Arc::save
+    u64 Revision = nextRevision(); // Unique per payload, changes on every setData
+
+    // Raw and size accessors only reflect pending data once it has been compressed.
+    // Pending data asked for compressed is compressed with policy, use Arc::getCompressedData to get the arc's.
+    // Returns an empty vector if the data cannot be decompressed or compressed.
+    std::span<const u8> getRawData() const;
+    std::vector<u8> getData(bool decompress = true, const CompressionPolicy& policy = {}) const;
     void setData(std::span<const u8> data, bool compress = true);
     void setData(const QByteArray& data, bool compress = true);
+
+    // Keeps the pending data and returns false if compression fails
+    bool compressPendingData(const CompressionPolicy& policy = {});
+    void setRawData(std::vector<u8> data);
+
+    static std::vector<u8> compressData(std::span<const u8> data, const CompressionPolicy& policy = {});
+    static u64 nextRevision();
 };
 
 class Arc
@@ -34,14 +57,48 @@ public:
     static constexpr u32 Magic = 0x435241; // "ARC\0"
     static constexpr s16 Version = 0x0011;
 
+    enum class LoadMode
+    {
+        Copy,   // Read every entry into memory up front
+        Mapped, // Map the file and only copy entries once they are modified
+    };
+
 private:
     static constexpr u32 DataAlignment = 0x10;
 
+    struct PathHash
+    {
+        using is_transparent = void;
+        size_t operator()(QStringView path) const { return qHash(path); }
+    };
+
+    // Where an entry of the sorted entry list lives in the file, as of the last load or save
+    struct DiskEntry
+    {
+        QString Path;
+        u32 Offset;
+        u32 CompSize;
+        u64 Revision;
+    };
+
 protected:
     std::filesystem::path path;
     std::vector<ArcEntry> entries;
+    std::shared_ptr<QFile> mappedFile;
 
-    void load();
+    // Path -> index into entries. The first entry with a given path wins, same as a linear scan would.
+    mutable std::unordered_map<QString, size_t, PathHash, std::equal_to<>> entryIndex;
+    mutable PayloadCache payloadCache;
+    CompressionPolicy compression;
+
+    std::vector<DiskEntry> diskEntries;
+    qint64 diskSize = 0;
+
+    void load(LoadMode mode);
+    void detach();
+
+    ArcEntry& insertEntry(ArcEntry entry);
+    void rebuildIndex() const;
 
     virtual std::vector<const ArcEntry*> getSortedEntries() const {
         std::vector<const ArcEntry*> sorted;
@@ -51,11 +108,21 @@ protected:
         return sorted;
     }
     
+    Arc() = default;
+
 public:
-    explicit Arc(std::filesystem::path path);
+    explicit Arc(std::filesystem::path path, LoadMode mode = LoadMode::Copy);
+
+    // New arc without any entries, nothing is written until it is saved
+    static Arc create(std::filesystem::path path);
 
+    virtual ~Arc();
+
+    Arc(Arc&&) noexcept;
+    Arc& operator=(Arc&&) noexcept;
+
+    // Read only, entries are added, renamed and replaced through the functions below so the path index stays in sync
     std::span<const ArcEntry> getEntries() const;
-    std::vector<ArcEntry>& getEntries();
 
     const ArcEntry* findEntry(QStringView path) const;
     ArcEntry* findEntry(QStringView path);
@@ -65,8 +132,46 @@ public:
 
     ArcEntry& addEntry(const QString& fpath, const QString& typeName, std::span<const u8> data, bool compressed = false, u32 realSize = 0);
     ArcEntry& addEntry(const QString& fpath, const QString& typeName, const QByteArray& data, bool compressed = false, u32 realSize = 0);
+    ArcEntry& addEntry(const QString& fpath, u32 typeHash, std::span<const u8> data, bool compressed = false, u32 realSize = 0);
+
+    // Decompressed data of an entry, cached per arc. The view owns its buffer, so it stays valid
+    // even after the entry is modified or the payload is evicted.
+    PayloadView getDataView(const ArcEntry& entry) const;
+
+    const PayloadCache::Stats& getCacheStats() const;
+    void setCacheCapacity(size_t bytes);
+
+    // Copies an entry from another arc as is. The compressed payload is shared rather than copied or
+    // re-encoded. Replaces the data of an existing entry with the same path, otherwise adds a new one.
+    ArcEntry& copyRawEntry(const ArcEntry& source);
+    ArcEntry& copyRawEntry(const ArcEntry& source, const QString& path);
+
+    // Entry paths must be changed through this so lookups stay in sync
+    void renameEntry(ArcEntry& entry, const QString& newPath);
+
+    // Applies to entries compressed from now on, entries that were already compressed keep their data
+    void setCompressionPolicy(const CompressionPolicy& policy);
+    const CompressionPolicy& getCompressionPolicy() const;
+
+    // Compressed data of an entry, pending data is compressed with the arc's policy
+    std::vector<u8> getCompressedData(const ArcEntry& entry) const;
+
+    // Compresses every entry with pending data on the global thread pool, called by save().
+    // Returns false if any entry failed to compress, those keep their pending data.
+    bool compressPendingEntries();
+
+    // Returns false if the arc could not be written, the file on disk is left as it was
+    virtual bool save(const std::filesystem::path& path = {});
+
+    // Only writes entries modified since the last load or save. Payloads are never patched in place,
+    // even if they would fit their old slot: modified entries are always appended to the end of the
+    // file and the file table is rewritten once they are on disk, so an interrupted save leaves the
+    // old table pointing at the old payloads. The file grows by every modified payload until
+    // compact() is called. Falls back to a full save if entries were added, removed, renamed or reordered.
+    virtual bool saveIncremental();
 
-    virtual void save(const std::filesystem::path& path = {});
+    // Full rewrite, drops the dead space left behind by saveIncremental()
+    bool compact();
 };
 
 }
@@ -1,53 +1,50 @@
 #include "BossSet.h"
 
-#include <QDataStream>
+#include "Util/SpanReader.h"
+#include "Util/SpanWriter.h"
 
 
 Resources::Spawn Resources::BossSet::deserialize(const QByteArray& data)
 {
-    QDataStream stream(data);
-    stream.setByteOrder(QDataStream::LittleEndian);
-
-    Spawn spawn;
-
-    u32 version;
-    int count;
+    return deserialize(std::span((const u8*)data.data(), (size_t)data.size()));
+}
 
-    stream >> version;
-    stream >> count;
+Resources::Spawn Resources::BossSet::deserialize(std::span<const u8> data)
+{
+    Util::SpanReader reader(data);
 
+    const auto version = reader.read<u32>();
     if (version != Version)
     {
         qCritical("Invalid version %08X", version);
         return {};
     }
 
+    const auto count = reader.read<s32>();
     if (count > 1)
     {
         qCritical("Multiple Spawns per BossSet Resource is not supported");
         return {};
     }
 
-    Spawn s;
-    stream.readRawData((char*)&s, sizeof(Spawn));
-
-    return s;
-}
+    Spawn spawn;
+    if (!reader.read(spawn))
+    {
+        qCritical("Truncated Spawn");
+        return {};
+    }
 
-Resources::Spawn Resources::BossSet::deserialize(std::span<const u8> data)
-{
-    return deserialize(QByteArray((const char*)data.data(), data.size()));
+    return spawn;
 }
 
 QByteArray Resources::BossSet::serialize(const Spawn& spawn)
 {
-    QByteArray data;
-    QDataStream stream(&data, QIODeviceBase::WriteOnly);
-    stream.setByteOrder(QDataStream::LittleEndian);
+    QByteArray data(sizeof(u32) + sizeof(s32) + sizeof(Spawn), Qt::Uninitialized);
+    Util::SpanWriter writer(data);
 
-    stream << Version;
-    stream << 1;
-    stream.writeRawData((const char*)&spawn, sizeof(Spawn));
+    writer.write(Version);
+    writer.write<s32>(1);
+    writer.write(spawn);
 
     return data;
 }
@@ -0,0 +1,130 @@
+#include "Compression.h"
+
+#include <QtLogging>
+
+#include <algorithm>
+#include <memory>
+
+#include <zlib.h>
+
+#ifdef MHGU_HAS_LIBDEFLATE
+#include <libdeflate.h>
+#endif
+
+
+namespace
+{
+
+std::vector<u8> compressZlib(std::span<const u8> data, int level)
+{
+    uLongf compSize = compressBound((uLong)data.size());
+    std::vector<u8> compressed(compSize);
+
+    if (compress2(compressed.data(), &compSize, data.data(), (uLong)data.size(), level) != Z_OK)
+    {
+        qCritical("Failed to compress data");
+        return {};
+    }
+
+    compressed.resize(compSize);
+    return compressed;
+}
+
+#ifdef MHGU_HAS_LIBDEFLATE
+std::vector<u8> compressLibdeflate(std::span<const u8> data, int level)
+{
+    struct CompressorDeleter
+    {
+        void operator()(libdeflate_compressor* compressor) const { libdeflate_free_compressor(compressor); }
+    };
+
+    // Compressors are expensive to set up, keep one around per thread for the last used level
+    thread_local std::unique_ptr<libdeflate_compressor, CompressorDeleter> compressor;
+    thread_local int compressorLevel = -1;
+
+    if (!compressor || compressorLevel != level)
+    {
+        compressor.reset(libdeflate_alloc_compressor(level));
+        compressorLevel = level;
+
+        if (!compressor)
+        {
+            qCritical("Failed to create compressor");
+            compressorLevel = -1;
+            return {};
+        }
+    }
+
+    std::vector<u8> compressed(libdeflate_zlib_compress_bound(compressor.get(), data.size()));
+
+    const auto compSize = libdeflate_zlib_compress(compressor.get(), data.data(), data.size(), compressed.data(), compressed.size());
+    if (compSize == 0)
+    {
+        qCritical("Failed to compress data");
+        return {};
+    }
+
+    compressed.resize(compSize);
+    return compressed;
+}
+#endif
+
+}
+
+Resources::CompressionPolicy Resources::CompressionPolicy::fromPreset(Preset preset)
+{
+    const auto engine = isAvailable(Backend::Libdeflate) ? Backend::Libdeflate : Backend::Zlib;
+
+    switch (preset)
+    {
+    case Preset::Stored:
+        return { .Engine = Backend::Zlib, .Level = StoredLevel };
+    case Preset::Fast:
+        return { .Engine = engine, .Level = 1 };
+    case Preset::Best:
+    {
+        CompressionPolicy policy = { .Engine = engine };
+        policy.Level = policy.maxLevel();
+        return policy;
+    }
+    case Preset::Default:
+    default:
+        return { .Engine = engine, .Level = DefaultLevel };
+    }
+}
+
+bool Resources::CompressionPolicy::isAvailable(Backend backend)
+{
+    switch (backend)
+    {
+    case Backend::Zlib:
+        return true;
+    case Backend::Libdeflate:
+#ifdef MHGU_HAS_LIBDEFLATE
+        return true;
+#else
+        return false;
+#endif
+    default:
+        return false;
+    }
+}
+
+int Resources::CompressionPolicy::maxLevel() const
+{
+    return Engine == Backend::Libdeflate ? 12 : Z_BEST_COMPRESSION;
+}
+
+std::vector<u8> Resources::CompressionPolicy::compress(std::span<const u8> data) const
+{
+    const auto level = std::clamp(Level, StoredLevel, maxLevel());
+
+#ifdef MHGU_HAS_LIBDEFLATE
+    if (Engine == Backend::Libdeflate)
+    {
+        return compressLibdeflate(data, level);
+    }
+#endif
+
+    return compressZlib(data, level);
+}
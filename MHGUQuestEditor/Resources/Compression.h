@@ -0,0 +1,44 @@
+#pragma once
+
+#include <Common.h>
+
+#include <span>
+#include <vector>
+
+
+namespace Resources
+{
+
+// How arc entries are compressed on save. Every backend produces a plain zlib stream,
+// so the choice only affects save speed and file size, never compatibility.
+struct CompressionPolicy
+{
+    enum class Backend
+    {
+        Zlib,
+        Libdeflate, // Only available when external/libdeflate is present at configure time
+    };
+
+    enum class Preset
+    {
+        Stored,  // Deflate stored blocks, no compression at all
+        Fast,
+        Default,
+        Best,
+    };
+
+    static constexpr int StoredLevel = 0;
+    static constexpr int DefaultLevel = 6;
+
+    Backend Engine = Backend::Zlib;
+    int Level = DefaultLevel;
+
+    static CompressionPolicy fromPreset(Preset preset);
+    static bool isAvailable(Backend backend);
+
+    int maxLevel() const;
+
+    std::vector<u8> compress(std::span<const u8> data) const;
+};
+
+}
@@ -0,0 +1,221 @@
+#include "DataBundle.h"
+
+#include "Util/SpanReader.h"
+#include "Util/SpanWriter.h"
+
+#include <QResource>
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+
+
+std::optional<Resources::DataBundle> Resources::DataBundle::fromData(std::span<const u8> data)
+{
+    Util::SpanReader reader(data);
+
+    const auto magic = reader.read<u32>();
+    if (magic != DataBundleHeader::Magic)
+    {
+        qCritical("Invalid magic %08X", magic);
+        return std::nullopt;
+    }
+
+    DataBundleHeader header{};
+    if (!reader.read(header) || header.Version != DataBundleHeader::CurrentVersion)
+    {
+        qCritical("Unsupported data bundle version %u", header.Version);
+        return std::nullopt;
+    }
+
+    DataBundle bundle;
+    bundle.data = data;
+    bundle.tables.resize(header.TableCount);
+
+    for (auto& table : bundle.tables)
+    {
+        if (!reader.read(table))
+        {
+            qCritical("Truncated data bundle table list");
+            return std::nullopt;
+        }
+
+        table.Name[DataBundleTable::MaxNameLength] = '\0';
+
+        const auto cellsSize = (u64)table.ColumnCount * table.RowCount * sizeof(u32);
+        if (table.Offset > data.size() || cellsSize > data.size() - table.Offset)
+        {
+            qCritical("Table %s runs past the end of the data bundle", table.Name);
+            return std::nullopt;
+        }
+    }
+
+    // The string pool closes out the file, every string in it is null terminated
+    if (header.StringPoolSize == 0 || header.StringPoolSize > data.size() || data.back() != 0)
+    {
+        qCritical("Invalid data bundle string pool");
+        return std::nullopt;
+    }
+
+    bundle.strings = std::string_view((const char*)data.data() + data.size() - header.StringPoolSize, header.StringPoolSize);
+    return bundle;
+}
+
+const Resources::DataBundle& Resources::DataBundle::builtin()
+{
+    static const QByteArray storage = [] {
+        const QResource resource(":/res/data.bin");
+        if (!resource.isValid())
+            qFatal("Failed to open data.bin");
+
+        // Uncompressed resources are part of the executable image and can be used as is
+        if (resource.compressionAlgorithm() == QResource::NoCompression)
+            return QByteArray::fromRawData((const char*)resource.data(), (qsizetype)resource.size());
+
+        return resource.uncompressedData();
+    }();
+
+    static const DataBundle bundle = [] {
+        auto bundle = fromData({ (const u8*)storage.data(), (size_t)storage.size() });
+        if (!bundle)
+            qFatal("Failed to load data.bin");
+
+        return std::move(*bundle);
+    }();
+
+    return bundle;
+}
+
+Resources::DataBundle::Table Resources::DataBundle::table(std::string_view name) const
+{
+    const auto it = std::ranges::find_if(tables, [name](const DataBundleTable& table) {
+        return name == table.Name;
+    });
+
+    if (it == tables.end())
+    {
+        qCritical("Data bundle has no table %.*s", (int)name.size(), name.data());
+        return {};
+    }
+
+    Table table;
+    table.bundle = this;
+    table.info = *it;
+    return table;
+}
+
+u32 Resources::DataBundle::Table::cell(u32 row, u32 column) const
+{
+    if (!bundle || row >= info.RowCount || column >= info.ColumnCount)
+        return 0;
+
+    u32 value;
+    std::memcpy(&value, bundle->data.data() + info.Offset + ((size_t)row * info.ColumnCount + column) * sizeof(u32), sizeof(u32));
+    return value;
+}
+
+s32 Resources::DataBundle::Table::integer(u32 row, u32 column) const
+{
+    return (s32)cell(row, column);
+}
+
+float Resources::DataBundle::Table::number(u32 row, u32 column) const
+{
+    return std::bit_cast<float>(cell(row, column));
+}
+
+std::string_view Resources::DataBundle::Table::string(u32 row, u32 column) const
+{
+    if (!bundle)
+        return {};
+
+    const auto offset = cell(row, column);
+    if (offset >= bundle->strings.size())
+        return {};
+
+    const auto value = bundle->strings.substr(offset);
+    return value.substr(0, value.find('\0'));
+}
+
+QString Resources::DataBundle::Table::text(u32 row, u32 column) const
+{
+    const auto value = string(row, column);
+    return QString::fromUtf8(value.data(), (qsizetype)value.size());
+}
+
+void Resources::DataBundleBuilder::beginTable(std::string_view name, u32 columns)
+{
+    tables.push_back({ std::string(name), columns, {} });
+}
+
+void Resources::DataBundleBuilder::addInteger(s32 value)
+{
+    tables.back().Cells.push_back((u32)value);
+}
+
+void Resources::DataBundleBuilder::addNumber(float value)
+{
+    tables.back().Cells.push_back(std::bit_cast<u32>(value));
+}
+
+void Resources::DataBundleBuilder::addString(std::string_view value)
+{
+    // Identical strings share one copy in the pool
+    auto [it, inserted] = stringOffsets.try_emplace(std::string(value), (u32)strings.size());
+    if (inserted)
+    {
+        strings.append(value);
+        strings.push_back('\0');
+    }
+
+    tables.back().Cells.push_back(it->second);
+}
+
+std::optional<QByteArray> Resources::DataBundleBuilder::build() const
+{
+    auto cellsOffset = sizeof(u32) + sizeof(DataBundleHeader) + tables.size() * sizeof(DataBundleTable);
+    auto size = cellsOffset;
+    for (const auto& table : tables)
+    {
+        if (table.Name.size() > DataBundleTable::MaxNameLength || table.Columns == 0 || table.Cells.size() % table.Columns != 0)
+        {
+            qCritical("Malformed table %s", table.Name.c_str());
+            return std::nullopt;
+        }
+
+        size += table.Cells.size() * sizeof(u32);
+    }
+
+    // An empty pool still gets a terminator so every bundle ends with one
+    const auto pool = strings.empty() ? std::string(1, '\0') : strings;
+    size += pool.size();
+
+    QByteArray data(size, Qt::Uninitialized);
+    Util::SpanWriter writer(data);
+
+    writer.write(DataBundleHeader::Magic);
+    writer.write(DataBundleHeader{
+        .Version = DataBundleHeader::CurrentVersion,
+        .TableCount = (u32)tables.size(),
+        .StringPoolSize = (u32)pool.size()
+    });
+
+    for (const auto& table : tables)
+    {
+        DataBundleTable info{};
+        std::memcpy(info.Name, table.Name.data(), table.Name.size());
+        info.ColumnCount = table.Columns;
+        info.RowCount = (u32)(table.Cells.size() / table.Columns);
+        info.Offset = (u32)cellsOffset;
+
+        writer.write(info);
+        cellsOffset += table.Cells.size() * sizeof(u32);
+    }
+
+    for (const auto& table : tables)
+        writer.writeBytes({ (const u8*)table.Cells.data(), table.Cells.size() * sizeof(u32) });
+
+    writer.writeBytes({ (const u8*)pool.data(), pool.size() });
+
+    return data;
+}
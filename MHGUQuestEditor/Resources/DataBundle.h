@@ -0,0 +1,108 @@
+#pragma once
+
+#include <Common.h>
+
+#include <QByteArray>
+#include <QString>
+
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+
+namespace Resources
+{
+
+#pragma pack(push, 1)
+
+struct DataBundleHeader
+{
+    static constexpr u32 Magic = 0x4244484D; // MHDB
+    static constexpr u32 CurrentVersion = 1;
+
+    u32 Version;
+    u32 TableCount;
+    u32 StringPoolSize;
+};
+
+struct DataBundleTable
+{
+    static constexpr size_t MaxNameLength = 31;
+
+    char Name[MaxNameLength + 1];
+    u32 ColumnCount;
+    u32 RowCount;
+    u32 Offset; // Of the first cell, from the start of the file
+};
+
+#pragma pack(pop)
+
+// Lookup data of the editor (res/*.json), compiled into one file at build time.
+// Every table is a grid of 4 byte cells, each holding an integer, a float or an offset into
+// the string pool at the end of the file, so it is read in place instead of being parsed.
+class DataBundle
+{
+public:
+    class Table
+    {
+    public:
+        u32 rows() const { return info.RowCount; }
+        u32 columns() const { return info.ColumnCount; }
+
+        // Out of range cells read as 0 or empty
+        s32 integer(u32 row, u32 column) const;
+        float number(u32 row, u32 column) const;
+        std::string_view string(u32 row, u32 column) const;
+        QString text(u32 row, u32 column) const;
+
+    private:
+        friend class DataBundle;
+
+        u32 cell(u32 row, u32 column) const;
+
+        const DataBundle* bundle = nullptr;
+        DataBundleTable info{};
+    };
+
+    // The bundle reads straight from data, which has to outlive it
+    static std::optional<DataBundle> fromData(std::span<const u8> data);
+
+    // The bundle compiled into the editor's resources
+    static const DataBundle& builtin();
+
+    Table table(std::string_view name) const;
+
+private:
+    std::span<const u8> data;
+    std::vector<DataBundleTable> tables;
+    std::string_view strings;
+};
+
+class DataBundleBuilder
+{
+public:
+    // Cells are added row by row to the table that was started last
+    void beginTable(std::string_view name, u32 columns);
+    void addInteger(s32 value);
+    void addNumber(float value);
+    void addString(std::string_view value);
+
+    std::optional<QByteArray> build() const;
+
+private:
+    struct PendingTable
+    {
+        std::string Name;
+        u32 Columns;
+        std::vector<u32> Cells;
+    };
+
+    std::vector<PendingTable> tables;
+    std::string strings;
+    std::unordered_map<std::string, u32> stringOffsets;
+};
+
+}
@@ -1,20 +1,23 @@
 #include "EmSetList.h"
 
-#include <QDataStream>
-#include <QIODevice>
+#include "Util/SpanReader.h"
+#include "Util/SpanWriter.h"
 
+#include <cstring>
 #include <ranges>
 
 
 Resources::EmSetList Resources::EmSetList::deserialize(const QByteArray& data)
 {
-    QDataStream stream(data);
-    stream.setByteOrder(QDataStream::LittleEndian);
+    return deserialize(std::span((const u8*)data.data(), (size_t)data.size()));
+}
 
-    EslHeader eslHeader;
-    stream.readRawData((char*)&eslHeader, sizeof(EslHeader));
+Resources::EmSetList Resources::EmSetList::deserialize(std::span<const u8> data)
+{
+    Util::SpanReader reader(data);
 
-    if (eslHeader.Magic != EslMagic)
+    EslHeader eslHeader{};
+    if (!reader.read(eslHeader) || eslHeader.Magic != EslMagic)
     {
         qCritical("Invalid magic for ESL %08X", eslHeader.Magic);
         return {};
@@ -26,12 +29,12 @@ Resources::EmSetList Resources::EmSetList::deserialize(const QByteArray& data)
         if (offset == 0)
             continue;
 
-        ZakoPack pack;
-
-        stream.device()->seek(offset);
-
         EsdHeader esdHeader;
-        stream.readRawData((char*)&esdHeader, sizeof(EsdHeader));
+        if (!reader.seek(offset) || !reader.read(esdHeader))
+        {
+            qCritical("ESD at %08X is out of bounds", offset);
+            return {};
+        }
 
         if (esdHeader.Magic != EsdMagic)
         {
@@ -45,30 +48,23 @@ Resources::EmSetList Resources::EmSetList::deserialize(const QByteArray& data)
             continue;
         }
 
-        for (u16 i = 0; i < esdHeader.EmsCount; ++i)
+        const auto ems = reader.readBytes(esdHeader.EmsCount * sizeof(Ems));
+        if (ems.empty())
         {
-            Ems ems;
-            stream.readRawData((char*)&ems, sizeof(Ems));
-            pack.Ems.push_back(ems);
+            qCritical("Truncated ESD at %08X", offset);
+            return {};
         }
 
-        esl.Packs.push_back(pack);
+        auto& pack = esl.Packs.emplace_back();
+        pack.Ems.resize(esdHeader.EmsCount);
+        std::memcpy(pack.Ems.data(), ems.data(), ems.size());
     }
 
     return esl;
 }
 
-Resources::EmSetList Resources::EmSetList::deserialize(std::span<const u8> data)
-{
-    return deserialize(QByteArray((const char*)data.data(), data.size()));
-}
-
 QByteArray Resources::EmSetList::serialize(const EmSetList& esl)
 {
-    QByteArray data;
-    QDataStream stream(&data, QIODevice::WriteOnly);
-    stream.setByteOrder(QDataStream::LittleEndian);
-
     constexpr u32 offsetListOffset = offsetof(EslHeader, Offsets);
     constexpr EslHeader eslHeader = {
         .Magic = EslMagic,
@@ -77,33 +73,40 @@ QByteArray Resources::EmSetList::serialize(const EmSetList& esl)
     };
     constexpr size_t maxPacks = std::size(eslHeader.Offsets);
 
-    stream.writeRawData((const char*)&eslHeader, sizeof(EslHeader));
-    
-    std::vector<u32> offsets;
-
     if (esl.Packs.size() > maxPacks)
         qWarning("Too many packs, only writing first %zu", maxPacks);
 
-    for (const auto& pack : esl.Packs | std::views::take(maxPacks))
+    const auto packs = esl.Packs | std::views::take(maxPacks);
+
+    size_t size = sizeof(EslHeader);
+    for (const auto& pack : packs)
+        size += sizeof(EsdHeader) + pack.Ems.size() * sizeof(Ems);
+
+    QByteArray data(size, Qt::Uninitialized);
+    Util::SpanWriter writer(data);
+
+    writer.write(eslHeader);
+
+    std::vector<u32> offsets;
+
+    for (const auto& pack : packs)
     {
-        offsets.push_back((u32)stream.device()->pos());
+        offsets.push_back((u32)writer.pos());
         const EsdHeader esdHeader = {
             .Magic = EsdMagic,
             .Version = EsdVersion,
             .EmsCount = (u16)pack.Ems.size()
         };
 
-        stream.writeRawData((const char*)&esdHeader, sizeof(EsdHeader));
-        stream.writeRawData((const char*)pack.Ems.data(), pack.Ems.size() * sizeof(Ems));
+        writer.write(esdHeader);
+        writer.writeBytes({ (const u8*)pack.Ems.data(), pack.Ems.size() * sizeof(Ems) });
     }
 
     Q_ASSERT(offsets.size() <= maxPacks);
-    
-    const auto offsetsPtr = (u32*)(data.data() + offsetListOffset);
-    for (const auto [i, off] : std::views::enumerate(offsets))
-    {
-        offsetsPtr[i] = off;
-    }
+    Q_ASSERT(writer.ok() && writer.pos() == size);
+
+    writer.seek(offsetListOffset);
+    writer.writeBytes({ (const u8*)offsets.data(), offsets.size() * sizeof(u32) });
 
     return data;
 }
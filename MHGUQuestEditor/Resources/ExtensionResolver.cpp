@@ -12,6 +12,37 @@ QString Resources::ExtensionResolver::resolve(u32 hash)
     return it->second;
 }
 
+std::optional<u32> Resources::ExtensionResolver::resolveHash(const QString& extension)
+{
+    static const auto hashes = [] {
+        std::unordered_map<QString, std::optional<u32>> result;
+        for (const auto& [hash, ext] : extensions)
+        {
+            const auto [it, inserted] = result.try_emplace(ext, hash);
+            if (!inserted)
+                it->second.reset(); // Ambiguous
+        }
+
+        return result;
+    }();
+
+    const auto it = hashes.find(extension);
+    if (it != hashes.end())
+    {
+        return it->second;
+    }
+
+    // Unknown types are resolved to their hash in hex
+    bool ok = false;
+    const auto hash = extension.sliced(extension.startsWith('.') ? 1 : 0).toUInt(&ok, 16);
+    if (ok && extension.size() == 9)
+    {
+        return hash;
+    }
+
+    return std::nullopt;
+}
+
 const std::unordered_map<u32, QString> Resources::ExtensionResolver::extensions = {
     { "rAngleLimitData"_ext, ".AngleLimit" },
     { "rStageCameraData"_ext, ".scd" },
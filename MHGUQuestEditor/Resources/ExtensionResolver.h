@@ -4,6 +4,9 @@
 
 #include <QString>
 
+#include <optional>
+#include <unordered_map>
+
 
 namespace Resources
 {
@@ -13,6 +16,9 @@ class ExtensionResolver
 public:
     static QString resolve(u32 hash);
 
+    // Reverse of resolve(). Fails for extensions shared by several types, like .rem.
+    static std::optional<u32> resolveHash(const QString& extension);
+
 private:
     static const std::unordered_map<u32, QString> extensions;
 };
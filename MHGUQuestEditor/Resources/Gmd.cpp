@@ -1,69 +1,306 @@
 #include "Gmd.h"
 
-#include <QDataStream>
+#include "Util/SpanReader.h"
+#include "Util/SpanWriter.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <ctime>
+#include <ranges>
+#include <string_view>
+
+
+namespace
+{
+
+// The index table holds one entry per label followed by 256 hash buckets. Entries start with the
+// string index, the rest are hashes and pointers which are 4 bytes wide on 32 bit platforms and
+// 8 bytes wide on 64 bit platforms.
+struct LabelLayout
+{
+    size_t IndexStride;
+    size_t BucketSize;
+};
+
+constexpr u32 BucketCount = 256;
+constexpr LabelLayout LabelLayouts[] = {
+    { 20, 4 },
+    { 32, 8 },
+};
+
+// Size of the label section as given by the index counts, empty without labels
+size_t labelSectionSize(const Resources::GmdHeader& header, const LabelLayout& layout)
+{
+    if (header.IndexCount == 0)
+        return 0;
+
+    return (size_t)header.IndexCount * layout.IndexStride + BucketCount * layout.BucketSize + header.IndexNameBufferSize;
+}
+
+// Walks the index table and the label names a layout implies. Every entry has to point at an
+// existing string and the names have to fill their buffer exactly, one per entry. Strings or
+// table bytes read with the wrong layout fail this almost immediately.
+bool isLabelSection(const Resources::GmdHeader& header, const LabelLayout& layout, std::span<const u8> rest)
+{
+    const auto size = labelSectionSize(header, layout);
+    if (size > rest.size())
+        return false;
+
+    const auto tableSize = size - header.IndexNameBufferSize;
+    const std::string_view names((const char*)rest.data() + tableSize, header.IndexNameBufferSize);
+
+    Util::SpanReader reader(rest.first(tableSize));
+    size_t nameStart = 0;
+
+    for (u32 i = 0; i < header.IndexCount; ++i)
+    {
+        reader.seek((size_t)i * layout.IndexStride);
+        const auto index = reader.read<u32>();
+        if (!reader.ok() || index >= header.StringCount)
+            return false;
+
+        const auto nameEnd = names.find('\0', nameStart);
+        if (nameEnd == std::string_view::npos)
+            return false;
+
+        nameStart = nameEnd + 1;
+    }
+
+    // Every string still needs its terminator after the labels
+    return nameStart == names.size() && (size_t)std::ranges::count(rest.subspan(size), u8(0)) >= header.StringCount;
+}
+
+// The string buffer closes out the file. Older versions of the editor never updated StringBufferSize
+// and kept IndexCount while dropping the labels, so the header alone cannot be trusted. The layout
+// StringBufferSize agrees with is tried first, then the others. If none of them holds a valid label
+// section the file has none.
+size_t findLabelSectionSize(const Resources::GmdHeader& header, std::span<const u8> rest)
+{
+    if (header.IndexCount == 0)
+        return 0;
+
+    const auto declared = header.StringBufferSize <= rest.size() ? rest.size() - header.StringBufferSize : SIZE_MAX;
+
+    for (const bool agrees : { true, false })
+    {
+        for (const auto& layout : LabelLayouts)
+        {
+            const auto size = labelSectionSize(header, layout);
+            if ((size == declared) == agrees && isLabelSection(header, layout, rest))
+                return size;
+        }
+    }
+
+    return 0;
+}
+
+}
 
 
 Resources::Gmd Resources::Gmd::deserialize(const QByteArray& data)
 {
-    QDataStream stream(data);
-    stream.setByteOrder(QDataStream::LittleEndian);
+    return deserialize(std::span((const u8*)data.data(), (size_t)data.size()));
+}
+
+Resources::Gmd Resources::Gmd::deserialize(std::span<const u8> data)
+{
+    Util::SpanReader reader(data);
 
     Gmd gmd;
-    u32 magic;
-    stream >> magic;
+    const auto magic = reader.read<u32>();
     if (magic != GmdHeader::Magic)
     {
         qCritical("Invalid magic %08X", magic);
         return {};
     }
 
-    stream.readRawData((char*)&gmd.Header, sizeof(GmdHeader));
+    if (!reader.read(gmd.Header))
+    {
+        qCritical("Truncated GMD header");
+        return {};
+    }
+
+    const auto packageName = reader.readBytes(gmd.Header.PackageNameLength + 1);
+    if (packageName.empty())
+    {
+        qCritical("Truncated GMD package name");
+        return {};
+    }
+
+    gmd.PackageName.assign((const char*)packageName.data(), gmd.Header.PackageNameLength);
+
+    const auto labelSection = reader.readBytes(findLabelSectionSize(gmd.Header, data.subspan(reader.pos())));
+    gmd.labelSection.assign(labelSection.begin(), labelSection.end());
+    gmd.parseLabels();
 
-    gmd.PackageName.resize(gmd.Header.PackageNameLength + 1);
-    stream.readRawData(gmd.PackageName.data(), gmd.Header.PackageNameLength + 1);
+    // Everything after the labels is string data, whatever the header claims
+    const auto strings = reader.readBytes(reader.remaining());
+
+    gmd.strings.assign((const char*)strings.data(), strings.size());
+    gmd.offsets.reserve(gmd.Header.StringCount + 1);
+
+    const char* const begin = gmd.strings.data();
+    const char* const end = begin + gmd.strings.size();
+    const char* current = begin;
 
     for (u32 i = 0; i < gmd.Header.StringCount; ++i)
     {
-        // Read null-terminated string
-        std::string entry;
-        char c;
-        do
+        const auto terminator = current < end ? (const char*)std::memchr(current, '\0', end - current) : nullptr;
+        if (!terminator)
         {
-            stream.readRawData(&c, 1);
-            if (c != '\0')
-                entry.push_back(c);
-        } while (c != '\0');
+            qCritical("Truncated GMD string %u", i);
+            return {};
+        }
 
-        gmd.Entries.push_back(std::move(entry));
+        gmd.offsets.push_back((u32)(current - begin));
+        current = terminator + 1;
     }
 
-    return gmd;
-}
+    // Anything after the last terminator is not part of any entry
+    gmd.strings.resize(current - begin);
+    gmd.offsets.push_back((u32)gmd.strings.size());
+    gmd.texts.resize(gmd.Header.StringCount);
 
-Resources::Gmd Resources::Gmd::deserialize(std::span<const u8> data)
-{
-    return deserialize(QByteArray((const char*)data.data(), data.size()));
+    return gmd;
 }
 
 QByteArray Resources::Gmd::serialize(const Gmd& gmd)
 {
-    QByteArray data;
-    QDataStream stream(&data, QIODeviceBase::WriteOnly);
-    stream.setByteOrder(QDataStream::LittleEndian);
-
     GmdHeader header = gmd.Header;
     header.PackageNameLength = (u32)gmd.PackageName.size();
-    header.StringCount = (u32)gmd.Entries.size();
+    header.StringCount = (u32)gmd.size();
+    header.StringBufferSize = (u32)gmd.strings.size();
     header.UpdateTime = std::time(nullptr);
 
-    stream << GmdHeader::Magic;
-    stream.writeRawData((const char*)&header, sizeof(GmdHeader));
-    stream.writeRawData(gmd.PackageName.c_str(), gmd.PackageName.size() + 1); // Include null terminator
-
-    for (const auto& entry : gmd.Entries)
+    // The label section is written back unchanged, without it there are no labels to declare
+    if (gmd.labelSection.empty())
     {
-        stream.writeRawData(entry.c_str(), entry.size() + 1); // Include null terminator
+        header.IndexCount = 0;
+        header.IndexNameBufferSize = 0;
     }
 
+    const auto size = sizeof(u32) + sizeof(GmdHeader) + gmd.PackageName.size() + 1 + gmd.labelSection.size() + gmd.strings.size();
+
+    QByteArray data(size, Qt::Uninitialized);
+    Util::SpanWriter writer(data);
+
+    writer.write(GmdHeader::Magic);
+    writer.write(header);
+    writer.writeBytes({ (const u8*)gmd.PackageName.c_str(), gmd.PackageName.size() + 1 }); // Include null terminator
+    writer.writeBytes(gmd.labelSection);
+    writer.writeBytes({ (const u8*)gmd.strings.data(), gmd.strings.size() });
+
     return data;
 }
+
+size_t Resources::Gmd::size() const
+{
+    return offsets.empty() ? 0 : offsets.size() - 1;
+}
+
+std::string_view Resources::Gmd::entry(size_t index) const
+{
+    if (index >= size())
+        return {};
+
+    // Leave out the null terminator
+    return std::string_view(strings).substr(offsets[index], offsets[index + 1] - offsets[index] - 1);
+}
+
+const QString& Resources::Gmd::text(size_t index) const
+{
+    static const QString empty;
+    if (index >= size())
+        return empty;
+
+    auto& text = texts[index];
+    if (!text)
+    {
+        const auto value = entry(index);
+        text = QString::fromUtf8(value.data(), (qsizetype)value.size());
+    }
+
+    return *text;
+}
+
+void Resources::Gmd::setEntry(size_t index, std::string_view value)
+{
+    if (offsets.empty())
+        offsets.push_back(0);
+
+    while (index >= size())
+    {
+        strings.push_back('\0');
+        offsets.push_back((u32)strings.size());
+    }
+
+    const auto start = offsets[index];
+    const auto length = offsets[index + 1] - start - 1;
+    strings.replace(start, length, value);
+
+    const auto delta = (s64)value.size() - (s64)length;
+    for (auto i = index + 1; i < offsets.size(); ++i)
+        offsets[i] = (u32)(offsets[i] + delta);
+
+    texts.resize(size());
+    texts[index].reset();
+}
+
+void Resources::Gmd::setEntry(size_t index, const QString& value)
+{
+    const auto utf8 = value.toUtf8();
+    setEntry(index, std::string_view(utf8.data(), (size_t)utf8.size()));
+}
+
+std::optional<size_t> Resources::Gmd::indexOf(std::string_view label) const
+{
+    const auto it = labels.find(label);
+    if (it == labels.end())
+        return std::nullopt;
+
+    return it->second;
+}
+
+void Resources::Gmd::parseLabels()
+{
+    const auto count = Header.IndexCount;
+    const auto namesSize = Header.IndexNameBufferSize;
+    if (count == 0 || labelSection.empty() || namesSize > labelSection.size())
+        return;
+
+    // Which layout the file uses follows from the size of the section
+    const auto tableSize = labelSection.size() - namesSize;
+    const auto layout = std::ranges::find_if(LabelLayouts, [=](const LabelLayout& l) {
+        return tableSize == (size_t)count * l.IndexStride + BucketCount * l.BucketSize;
+    });
+
+    if (layout == std::end(LabelLayouts))
+    {
+        qWarning("Unknown GMD label layout, labels are kept but cannot be looked up");
+        return;
+    }
+
+    Util::SpanReader reader(labelSection);
+    const std::string_view names((const char*)labelSection.data() + tableSize, namesSize);
+    size_t nameStart = 0;
+    labels.reserve(count);
+
+    // Label names are stored in the same order as the index table
+    for (u32 i = 0; i < count; ++i)
+    {
+        reader.seek((size_t)i * layout->IndexStride);
+        const auto index = reader.read<u32>();
+
+        const auto nameEnd = names.find('\0', nameStart);
+        if (!reader.ok() || nameEnd == std::string_view::npos)
+        {
+            qWarning("Truncated GMD label %u", i);
+            labels.clear();
+            return;
+        }
+
+        labels.emplace(names.substr(nameStart, nameEnd - nameStart), index);
+        nameStart = nameEnd + 1;
+    }
+}
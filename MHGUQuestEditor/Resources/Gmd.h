@@ -2,11 +2,15 @@
 
 #include <Common.h>
 
+#include <optional>
 #include <span>
 #include <string>
+#include <string_view>
+#include <unordered_map>
 #include <vector>
 
 #include <QByteArray>
+#include <QString>
 
 
 namespace Resources
@@ -28,17 +32,47 @@ struct GmdHeader
     u32 PackageNameLength;
 };
 
+#pragma pack(pop)
+
 struct Gmd
 {
     GmdHeader Header;
     std::string PackageName;
-    std::vector<std::string> Entries;
+
+    size_t size() const;
+
+    // Out of range entries read as empty
+    std::string_view entry(size_t index) const;
+    const QString& text(size_t index) const;
+
+    // Grows the table with empty entries if needed
+    void setEntry(size_t index, std::string_view value);
+    void setEntry(size_t index, const QString& value);
+
+    // Index of the entry with the given label, if the file has a label section
+    std::optional<size_t> indexOf(std::string_view label) const;
 
     static Gmd deserialize(const QByteArray& data);
     static Gmd deserialize(std::span<const u8> data);
     static QByteArray serialize(const Gmd& gmd);
-};
 
-#pragma pack(pop)
+private:
+    void parseLabels();
+
+    // Every entry back to back with its null terminator, exactly as in the file's string buffer
+    std::string strings;
+    std::vector<u32> offsets;
+    mutable std::vector<std::optional<QString>> texts;
+
+    struct LabelHash
+    {
+        using is_transparent = void;
+        size_t operator()(std::string_view label) const { return std::hash<std::string_view>{}(label); }
+    };
+
+    // Index table, hash buckets and label names, kept as is so they can be written back unchanged
+    std::vector<u8> labelSection;
+    std::unordered_map<std::string, u32, LabelHash, std::equal_to<>> labels;
+};
 
 }
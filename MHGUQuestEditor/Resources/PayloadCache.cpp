@@ -0,0 +1,62 @@
+#include "PayloadCache.h"
+
+
+Resources::PayloadCache::PayloadCache(size_t capacity)
+{
+    stats.Capacity = capacity;
+}
+
+Resources::PayloadView Resources::PayloadCache::find(u64 revision)
+{
+    const auto it = lookup.find(revision);
+    if (it == lookup.end())
+    {
+        stats.Misses++;
+        return {};
+    }
+
+    stats.Hits++;
+    nodes.splice(nodes.begin(), nodes, it->second);
+    return PayloadView(it->second->Payload);
+}
+
+Resources::PayloadView Resources::PayloadCache::insert(u64 revision, std::vector<u8> payload)
+{
+    if (const auto it = lookup.find(revision); it != lookup.end())
+    {
+        stats.Size -= it->second->Payload->size();
+        nodes.erase(it->second);
+        lookup.erase(it);
+    }
+
+    stats.Size += payload.size();
+    nodes.push_front({ .Revision = revision, .Payload = std::make_shared<const std::vector<u8>>(std::move(payload)) });
+    lookup.emplace(revision, nodes.begin());
+
+    evict(1);
+    return PayloadView(nodes.front().Payload);
+}
+
+void Resources::PayloadCache::setCapacity(size_t capacity)
+{
+    stats.Capacity = capacity;
+    evict(0);
+}
+
+void Resources::PayloadCache::clear()
+{
+    nodes.clear();
+    lookup.clear();
+    stats.Size = 0;
+}
+
+void Resources::PayloadCache::evict(size_t keep)
+{
+    while (stats.Size > stats.Capacity && nodes.size() > keep)
+    {
+        auto& node = nodes.back();
+        stats.Size -= node.Payload->size();
+        lookup.erase(node.Revision);
+        nodes.pop_back();
+    }
+}
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <Common.h>
+
+#include <list>
+#include <memory>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+
+namespace Resources
+{
+
+// Decompressed payload that keeps its buffer alive for as long as the view exists, even once
+// the payload was evicted from the cache or its entry was modified. Converts to std::span.
+class PayloadView
+{
+public:
+    PayloadView() = default;
+    explicit PayloadView(std::shared_ptr<const std::vector<u8>> payload) : payload(std::move(payload)) {}
+
+    const u8* data() const { return payload ? payload->data() : nullptr; }
+    size_t size() const { return payload ? payload->size() : 0; }
+    bool empty() const { return size() == 0; }
+
+    const u8* begin() const { return data(); }
+    const u8* end() const { return data() + size(); }
+
+private:
+    std::shared_ptr<const std::vector<u8>> payload;
+};
+
+// Bounded LRU of decompressed entry payloads, keyed by ArcEntry::Revision.
+// Stale revisions are never looked up again and simply age out.
+class PayloadCache
+{
+public:
+    static constexpr size_t DefaultCapacity = 16 * 1024 * 1024;
+
+    struct Stats
+    {
+        u64 Hits = 0;
+        u64 Misses = 0;
+        size_t Size = 0;     // Bytes currently held
+        size_t Capacity = 0; // Bytes held at most, aside from the most recent payload and live views
+    };
+
+    explicit PayloadCache(size_t capacity = DefaultCapacity);
+
+    // Returns an empty view on a miss
+    PayloadView find(u64 revision);
+
+    // Evicts least recently used payloads to make room, views handed out earlier stay valid
+    PayloadView insert(u64 revision, std::vector<u8> payload);
+
+    void setCapacity(size_t capacity);
+    void clear();
+
+    const Stats& getStats() const { return stats; }
+
+private:
+    struct Node
+    {
+        u64 Revision;
+        std::shared_ptr<const std::vector<u8>> Payload;
+    };
+
+    std::list<Node> nodes; // Most recently used first
+    std::unordered_map<u64, std::list<Node>::iterator> lookup;
+    Stats stats;
+
+    void evict(size_t keep);
+};
+
+}
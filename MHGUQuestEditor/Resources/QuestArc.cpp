@@ -4,12 +4,14 @@
 #include "ExtensionResolver.h"
 #include "Util/Crc32.h"
 
+#include <algorithm>
+#include <cctype>
 #include <ranges>
 
 using namespace Qt::StringLiterals;
 
-Resources::QuestArc::QuestArc(std::filesystem::path path, bool isRegularQuestArc)
-    : Arc(std::move(path)), questDataIndex(-1), questLinkIndex(-1), isRegularQuestArc(isRegularQuestArc)
+Resources::QuestArc::QuestArc(std::filesystem::path path, bool isRegularQuestArc, LoadMode mode)
+    : Arc(std::move(path), mode), questDataIndex(-1), questLinkIndex(-1), isRegularQuestArc(isRegularQuestArc)
 {
     for (size_t i = 0; i < getEntries().size(); i++)
     {
@@ -94,7 +96,7 @@ bool Resources::QuestArc::addQuestData(u32 questId, std::span<const u8> data, bo
     if (compressed && realSize != 0)
         entry.RealSize = realSize;
 
-    entries.push_back(entry);
+    insertEntry(std::move(entry));
     return true;
 }
 
@@ -125,7 +127,7 @@ bool Resources::QuestArc::addGmd(s32 languageId, const QString& name, std::span<
     if (compressed && realSize != 0)
         entry.RealSize = realSize;
 
-    entries.push_back(entry);
+    insertEntry(std::move(entry));
     return true;
 }
 
@@ -156,7 +158,7 @@ bool Resources::QuestArc::addSem(u32 mapId, u32 emId, u32 semId, std::span<const
     if (compressed && realSize != 0)
         entry.RealSize = realSize;
 
-    entries.push_back(entry);
+    insertEntry(std::move(entry));
     return true;
 }
 
@@ -187,7 +189,7 @@ bool Resources::QuestArc::addRem(u32 remId, std::span<const u8> data, bool compr
     if (compressed && realSize != 0)
         entry.RealSize = realSize;
 
-    entries.push_back(entry);
+    insertEntry(std::move(entry));
     return true;
 }
 
@@ -218,7 +220,7 @@ bool Resources::QuestArc::addEsl(u32 mapId, u32 eslId, std::span<const u8> data,
     if (compressed && realSize != 0)
         entry.RealSize = realSize;
 
-    entries.push_back(entry);
+    insertEntry(std::move(entry));
     return true;
 }
 
@@ -232,12 +234,20 @@ Resources::ArcEntry* Resources::QuestArc::getGmd(s32 languageId, const QString&
     return findEntry(Language::toString(languageId) + R"(\quest\questData\questData_)" + name);
 }
 
-void Resources::QuestArc::save(const std::filesystem::path& path)
+bool Resources::QuestArc::save(const std::filesystem::path& path)
 {
     if (isRegularQuestArc)
         fixOrder();
 
-    Arc::save(path);
+    return Arc::save(path);
+}
+
+bool Resources::QuestArc::saveIncremental()
+{
+    if (isRegularQuestArc)
+        fixOrder();
+
+    return Arc::saveIncremental();
 }
 
 std::vector<const Resources::ArcEntry*> Resources::QuestArc::getSortedEntries() const
@@ -294,6 +304,18 @@ std::vector<const Resources::ArcEntry*> Resources::QuestArc::getSortedEntries()
     return sorted;
 }
 
+bool Resources::QuestArc::isQuestArcPath(const std::filesystem::path& path)
+{
+    const auto filename = path.stem().string();
+    if (filename.size() != 8)
+        return false;
+
+    if (filename[0] != 'q')
+        return false;
+
+    return std::all_of(filename.begin() + 1, filename.end(), [](unsigned char c) { return std::isdigit(c); });
+}
+
 void Resources::QuestArc::fixOrder()
 {
     if (entries.size() < 22)
@@ -313,4 +335,6 @@ void Resources::QuestArc::fixOrder()
         std::swap(entries[questLinkIndex], entries[entries.size() - 9]);
         questLinkIndex = entries.size() - 9;
     }
+
+    rebuildIndex();
 }
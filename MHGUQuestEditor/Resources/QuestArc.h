@@ -10,7 +10,7 @@ namespace Resources
 class QuestArc : public Arc
 {
 public:
-    explicit QuestArc(std::filesystem::path path, bool isRegularQuestArc = true);
+    explicit QuestArc(std::filesystem::path path, bool isRegularQuestArc = true, LoadMode mode = LoadMode::Copy);
 
     const ArcEntry& getQuestData() const;
     ArcEntry& getQuestData();
@@ -35,10 +35,14 @@ public:
     const ArcEntry* getGmd(s32 languageId, const QString& name) const;
     ArcEntry* getGmd(s32 languageId, const QString& name);
 
-    void save(const std::filesystem::path& path = {}) override;
+    bool save(const std::filesystem::path& path = {}) override;
+    bool saveIncremental() override;
 
     std::vector<const ArcEntry*> getSortedEntries() const override;
 
+    // Quest arcs are named qXXXXXXX.arc
+    static bool isQuestArcPath(const std::filesystem::path& path);
+
 private:
     void fixOrder();
 
@@ -1,50 +1,49 @@
 #include "QuestData.h"
 
-#include <QBuffer>
-#include <QDataStream>
+#include "Util/SpanReader.h"
+#include "Util/SpanWriter.h"
 
 Resources::QuestData Resources::QuestData::deserialize(const QByteArray& data)
 {
-    QDataStream stream(data);
-    stream.setByteOrder(QDataStream::LittleEndian);
+    return deserialize(std::span((const u8*)data.data(), (size_t)data.size()));
+}
 
-    u32 magic;
-    s32 count;
-    stream >> magic;
-    stream >> count;
+Resources::QuestData Resources::QuestData::deserialize(std::span<const u8> data)
+{
+    Util::SpanReader reader(data);
 
+    const auto magic = reader.read<u32>();
     if (magic != Magic)
     {
         qCritical("Invalid magic %08X", magic);
         return {};
     }
 
-    if (count > 1) 
+    const auto count = reader.read<s32>();
+    if (count > 1)
     {
         qCritical("Multiple Quest Data per Quest Resource is not supported");
         return {};
     }
 
     QuestData quest;
-    stream.readRawData((char*)&quest, sizeof(QuestData));
+    if (!reader.read(quest))
+    {
+        qCritical("Truncated QuestData");
+        return {};
+    }
 
     return quest;
 }
 
-Resources::QuestData Resources::QuestData::deserialize(std::span<const u8> data)
-{
-    return deserialize(QByteArray((const char*)data.data(), data.size()));
-}
-
 QByteArray Resources::QuestData::serialize(const QuestData& quest)
 {
-    QByteArray data;
-    QDataStream stream(&data, QIODeviceBase::WriteOnly);
-    stream.setByteOrder(QDataStream::LittleEndian);
+    QByteArray data(sizeof(u32) + sizeof(s32) + sizeof(QuestData), Qt::Uninitialized);
+    Util::SpanWriter writer(data);
 
-    stream << Magic;
-    stream << 1;
-    stream.writeRawData((const char*)&quest, sizeof(QuestData));
+    writer.write(Magic);
+    writer.write<s32>(1);
+    writer.write(quest);
 
     return data;
 }
@@ -0,0 +1,215 @@
+#include "QuestDataFields.h"
+
+#include <QJsonArray>
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+namespace
+{
+
+using namespace Resources;
+
+u32 valueSize(QuestFieldType type)
+{
+    switch (type)
+    {
+    case QuestFieldType::U16:
+    case QuestFieldType::S16: return 2;
+    case QuestFieldType::U32:
+    case QuestFieldType::S32: return 4;
+    default: return 1;
+    }
+}
+
+s32 readValue(const u8* data, QuestFieldType type)
+{
+    switch (type)
+    {
+    case QuestFieldType::U8: return *data;
+    case QuestFieldType::S8:
+    case QuestFieldType::Char: return (s8)*data;
+    case QuestFieldType::U16: { u16 value; std::memcpy(&value, data, sizeof(value)); return value; }
+    case QuestFieldType::S16: { s16 value; std::memcpy(&value, data, sizeof(value)); return value; }
+    case QuestFieldType::U32:
+    case QuestFieldType::S32: { s32 value; std::memcpy(&value, data, sizeof(value)); return value; }
+    default: return 0;
+    }
+}
+
+QString readText(const u8* data, u32 size)
+{
+    const auto chars = (const char*)data;
+    return QString::fromLatin1(chars, (qsizetype)strnlen(chars, size));
+}
+
+const char* enumName(std::span<const QuestEnumValue> values, s32 value)
+{
+    const auto it = std::ranges::find(values, value, &QuestEnumValue::Value);
+    return it != values.end() ? it->Name : nullptr;
+}
+
+QJsonValue toJson(const QuestField& field, const u8* data);
+
+QJsonValue elementToJson(const QuestField& field, const u8* data)
+{
+    if (field.Type == QuestFieldType::Struct)
+    {
+        QJsonObject obj;
+        for (const auto& member : field.Fields)
+            obj[member.Name] = toJson(member, data + member.Offset);
+
+        return obj;
+    }
+
+    const auto value = readValue(data, field.Type);
+    if (const auto name = enumName(field.Enum, value))
+        return name;
+
+    return field.Type == QuestFieldType::U32 ? QJsonValue((qint64)(u32)value) : QJsonValue(value);
+}
+
+QJsonValue toJson(const QuestField& field, const u8* data)
+{
+    if (field.Type == QuestFieldType::Char)
+        return readText(data, field.Count);
+
+    if (field.Count == 1)
+        return elementToJson(field, data);
+
+    QJsonArray array;
+    for (u32 i = 0; i < field.Count; ++i)
+        array.append(elementToJson(field, data + i * field.Stride));
+
+    return array;
+}
+
+// Calls add for every leaf field with its path and its offset in QuestData
+void flatten(std::span<const QuestField> fields, const QString& prefix, u32 offset, auto&& add)
+{
+    for (const auto& field : fields)
+    {
+        const auto name = prefix + field.Name;
+        const auto fieldOffset = offset + field.Offset;
+
+        if (field.Type == QuestFieldType::Char || field.Count == 1)
+        {
+            if (field.Type == QuestFieldType::Struct)
+                flatten(field.Fields, name + '.', fieldOffset, add);
+            else
+                add(field, name, fieldOffset);
+
+            continue;
+        }
+
+        for (u32 i = 0; i < field.Count; ++i)
+        {
+            const auto element = QStringLiteral("%1[%2]").arg(name).arg(i);
+            const auto elementOffset = fieldOffset + i * field.Stride;
+
+            if (field.Type == QuestFieldType::Struct)
+                flatten(field.Fields, element + '.', elementOffset, add);
+            else
+                add(field, element, elementOffset);
+        }
+    }
+}
+
+}
+
+std::span<const QuestFieldRef> Resources::QuestFieldRef::all()
+{
+    static const auto refs = [] {
+        std::vector<QuestFieldRef> refs;
+        flatten(QuestDataFields, {}, 0, [&refs](const QuestField& field, const QString& path, u32 offset) {
+            QuestFieldRef ref;
+            ref.field = &field;
+            ref.fieldPath = path;
+            ref.fieldType = field.Type;
+            ref.fieldOffset = offset;
+            ref.fieldSize = field.Type == QuestFieldType::Char ? field.Count : valueSize(field.Type);
+            refs.push_back(std::move(ref));
+        });
+
+        return refs;
+    }();
+
+    return refs;
+}
+
+std::optional<Resources::QuestFieldRef> Resources::QuestFieldRef::find(std::string_view path)
+{
+    const auto name = QString::fromUtf8(path.data(), (qsizetype)path.size());
+    const auto refs = all();
+
+    const auto it = std::ranges::find(refs, name, &QuestFieldRef::fieldPath);
+    if (it == refs.end())
+        return std::nullopt;
+
+    return *it;
+}
+
+s32 Resources::QuestFieldRef::get(const QuestData& quest) const
+{
+    return readValue((const u8*)&quest + fieldOffset, fieldType);
+}
+
+void Resources::QuestFieldRef::set(QuestData& quest, s32 value) const
+{
+    if (fieldType == QuestFieldType::Char)
+        return;
+
+    // Keeps the low bytes, the same as assigning to the member
+    std::memcpy((u8*)&quest + fieldOffset, &value, fieldSize);
+}
+
+QString Resources::QuestFieldRef::text(const QuestData& quest) const
+{
+    if (fieldType == QuestFieldType::Char)
+        return readText((const u8*)&quest + fieldOffset, fieldSize);
+
+    const auto value = get(quest);
+    if (const auto name = enumName(field->Enum, value))
+        return name;
+
+    return fieldType == QuestFieldType::U32 ? QString::number((u32)value) : QString::number(value);
+}
+
+bool Resources::QuestFieldRef::isValid(const QuestData& quest) const
+{
+    return field->Enum.empty() || enumName(field->Enum, get(quest)) != nullptr;
+}
+
+QJsonObject Resources::questDataToJson(const QuestData& quest)
+{
+    QJsonObject obj;
+    for (const auto& field : QuestDataFields)
+        obj[field.Name] = toJson(field, (const u8*)&quest + field.Offset);
+
+    return obj;
+}
+
+QStringList Resources::diffQuestData(const QuestData& a, const QuestData& b)
+{
+    QStringList changes;
+    for (const auto& ref : QuestFieldRef::all())
+    {
+        if (std::memcmp((const u8*)&a + ref.offset(), (const u8*)&b + ref.offset(), ref.size()) != 0)
+            changes.append(QStringLiteral("%1: %2 -> %3").arg(ref.path(), ref.text(a), ref.text(b)));
+    }
+
+    return changes;
+}
+
+QStringList Resources::validateQuestData(const QuestData& quest)
+{
+    QStringList errors;
+    for (const auto& ref : QuestFieldRef::all())
+    {
+        if (!ref.isValid(quest))
+            errors.append(QStringLiteral("%1: %2 is not a known value").arg(ref.path()).arg(ref.get(quest)));
+    }
+
+    return errors;
+}
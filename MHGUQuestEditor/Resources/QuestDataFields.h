@@ -0,0 +1,371 @@
+#pragma once
+
+#include "QuestData.h"
+
+#include <QJsonObject>
+#include <QStringList>
+
+#include <cstddef>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <type_traits>
+
+
+namespace Resources
+{
+
+enum class QuestFieldType : u8
+{
+    U8,
+    S8,
+    U16,
+    S16,
+    U32,
+    S32,
+    Char, // Arrays of them are null padded strings
+    Struct,
+};
+
+struct QuestEnumValue
+{
+    const char* Name;
+    s32 Value;
+};
+
+// Layout of one member of QuestData or of a struct nested in it
+struct QuestField
+{
+    const char* Name;
+    u32 Offset; // From the start of the enclosing struct
+    QuestFieldType Type;
+    u32 Count; // 1 unless the field is an array
+    u32 Stride; // Size of one element
+    std::span<const QuestField> Fields; // Members of a struct field
+    std::span<const QuestEnumValue> Enum; // Values of an enum field, empty if it has no fixed set
+};
+
+template<typename T> inline constexpr std::span<const QuestField> QuestFieldsOf{};
+template<typename T> inline constexpr std::span<const QuestEnumValue> QuestEnumOf{};
+
+template<typename T>
+constexpr QuestFieldType questFieldTypeOf()
+{
+    if constexpr (std::is_enum_v<T>)
+        return questFieldTypeOf<std::underlying_type_t<T>>();
+    else if constexpr (std::is_same_v<T, char>)
+        return QuestFieldType::Char;
+    else if constexpr (std::is_same_v<T, u8>)
+        return QuestFieldType::U8;
+    else if constexpr (std::is_same_v<T, s8>)
+        return QuestFieldType::S8;
+    else if constexpr (std::is_same_v<T, u16>)
+        return QuestFieldType::U16;
+    else if constexpr (std::is_same_v<T, s16>)
+        return QuestFieldType::S16;
+    else if constexpr (std::is_same_v<T, u32>)
+        return QuestFieldType::U32;
+    else if constexpr (std::is_same_v<T, s32>)
+        return QuestFieldType::S32;
+    else
+        return QuestFieldType::Struct;
+}
+
+template<typename T>
+constexpr QuestField describeQuestField(const char* name, size_t offset)
+{
+    using Element = std::remove_all_extents_t<T>;
+    static_assert(std::rank_v<T> <= 1, "Only one dimensional arrays are described");
+
+    return {
+        .Name = name,
+        .Offset = (u32)offset,
+        .Type = questFieldTypeOf<Element>(),
+        .Count = std::is_array_v<T> ? (u32)std::extent_v<T> : 1,
+        .Stride = sizeof(Element),
+        .Fields = QuestFieldsOf<Element>,
+        .Enum = QuestEnumOf<Element>
+    };
+}
+
+#define QUEST_FIELD(Struct, Member) describeQuestField<decltype(Struct::Member)>(#Member, offsetof(Struct, Member))
+
+// Enums with a fixed set of values. Maps, levels, requirements and icons are listed
+// from the data bundle by the editor and are not checked here.
+
+#define QUEST_ENUM_VALUE(Enum, Value) QuestEnumValue{ #Value, (s32)Enum::Value }
+
+inline constexpr QuestEnumValue QuestTypeValues[] = {
+    QUEST_ENUM_VALUE(QuestType, Hunting),
+    QUEST_ENUM_VALUE(QuestType, Slaying),
+    QUEST_ENUM_VALUE(QuestType, Capture),
+    QUEST_ENUM_VALUE(QuestType, Gathering),
+    QUEST_ENUM_VALUE(QuestType, HuntAThon),
+    QUEST_ENUM_VALUE(QuestType, HuntAThonArena),
+};
+
+inline constexpr QuestEnumValue QuestSubTypeValues[] = {
+    QUEST_ENUM_VALUE(QuestSubType, Training),
+    QUEST_ENUM_VALUE(QuestSubType, Kokoto_Unlockable),
+    QUEST_ENUM_VALUE(QuestSubType, Pokke_Unlockable),
+    QUEST_ENUM_VALUE(QuestSubType, Yukumo_Unlockable),
+    QUEST_ENUM_VALUE(QuestSubType, Bherna_Unlockable),
+    QUEST_ENUM_VALUE(QuestSubType, Kokoto_Main),
+    QUEST_ENUM_VALUE(QuestSubType, Pokke_Main),
+    QUEST_ENUM_VALUE(QuestSubType, Yukumo_Main),
+    QUEST_ENUM_VALUE(QuestSubType, Bherna_Main),
+    QUEST_ENUM_VALUE(QuestSubType, ProwlerOnly),
+    QUEST_ENUM_VALUE(QuestSubType, Default),
+    QUEST_ENUM_VALUE(QuestSubType, SpecialPermit),
+};
+
+inline constexpr QuestEnumValue QuestEnemyLevelValues[] = {
+    QUEST_ENUM_VALUE(QuestEnemyLevel, Training),
+    QUEST_ENUM_VALUE(QuestEnemyLevel, LowRank),
+    QUEST_ENUM_VALUE(QuestEnemyLevel, HighRank),
+    QUEST_ENUM_VALUE(QuestEnemyLevel, GRank),
+};
+
+inline constexpr QuestEnumValue QuestStartTypeValues[] = {
+    QUEST_ENUM_VALUE(QuestStartType, Camp),
+    QUEST_ENUM_VALUE(QuestStartType, Random),
+    QUEST_ENUM_VALUE(QuestStartType, ElderDragon),
+};
+
+inline constexpr QuestEnumValue QuestBgmTypeValues[] = {
+    QUEST_ENUM_VALUE(QuestBgmType, Default),
+    QUEST_ENUM_VALUE(QuestBgmType, ProwlerSpecial),
+    QUEST_ENUM_VALUE(QuestBgmType, Training),
+};
+
+inline constexpr QuestEnumValue QuestClearTypeValues[] = {
+    QUEST_ENUM_VALUE(QuestClearType, OneTarget),
+    QUEST_ENUM_VALUE(QuestClearType, TwoTargets),
+    QUEST_ENUM_VALUE(QuestClearType, OneTargetAndTicket),
+};
+
+inline constexpr QuestEnumValue QuestClearParamValues[] = {
+    QUEST_ENUM_VALUE(QuestClearParam, None),
+    QUEST_ENUM_VALUE(QuestClearParam, Hunt),
+    QUEST_ENUM_VALUE(QuestClearParam, Capture),
+    QUEST_ENUM_VALUE(QuestClearParam, HuntAllLargeMonsters),
+    QUEST_ENUM_VALUE(QuestClearParam, SlayTotalOfTargets),
+    QUEST_ENUM_VALUE(QuestClearParam, DeliverItem),
+    QUEST_ENUM_VALUE(QuestClearParam, EarnWycademyPoints),
+    QUEST_ENUM_VALUE(QuestClearParam, DeliverPawPass),
+    QUEST_ENUM_VALUE(QuestClearParam, BreakParts),
+    QUEST_ENUM_VALUE(QuestClearParam, MountAndTopple),
+};
+
+inline constexpr QuestEnumValue QuestCarveLevelValues[] = {
+    QUEST_ENUM_VALUE(QuestCarveLevel, LowRankSpecial),
+    QUEST_ENUM_VALUE(QuestCarveLevel, LowRank),
+    QUEST_ENUM_VALUE(QuestCarveLevel, HighRank),
+    QUEST_ENUM_VALUE(QuestCarveLevel, Arena),
+    QUEST_ENUM_VALUE(QuestCarveLevel, GRank),
+};
+
+inline constexpr QuestEnumValue QuestGatheringLevelValues[] = {
+    QUEST_ENUM_VALUE(QuestGatheringLevel, Arena0),
+    QUEST_ENUM_VALUE(QuestGatheringLevel, LowRank),
+    QUEST_ENUM_VALUE(QuestGatheringLevel, HighRank),
+    QUEST_ENUM_VALUE(QuestGatheringLevel, Arena1),
+    QUEST_ENUM_VALUE(QuestGatheringLevel, Special0),
+    QUEST_ENUM_VALUE(QuestGatheringLevel, Special1),
+    QUEST_ENUM_VALUE(QuestGatheringLevel, Special2),
+    QUEST_ENUM_VALUE(QuestGatheringLevel, GRank),
+};
+
+inline constexpr QuestEnumValue QuestFishingLevelValues[] = {
+    QUEST_ENUM_VALUE(QuestFishingLevel, LowRankSpecial),
+    QUEST_ENUM_VALUE(QuestFishingLevel, LowRank),
+    QUEST_ENUM_VALUE(QuestFishingLevel, HighRank),
+    QUEST_ENUM_VALUE(QuestFishingLevel, Arena),
+    QUEST_ENUM_VALUE(QuestFishingLevel, GRank),
+};
+
+#undef QUEST_ENUM_VALUE
+
+template<> inline constexpr std::span<const QuestEnumValue> QuestEnumOf<QuestType> = QuestTypeValues;
+template<> inline constexpr std::span<const QuestEnumValue> QuestEnumOf<QuestSubType> = QuestSubTypeValues;
+template<> inline constexpr std::span<const QuestEnumValue> QuestEnumOf<QuestEnemyLevel> = QuestEnemyLevelValues;
+template<> inline constexpr std::span<const QuestEnumValue> QuestEnumOf<QuestStartType> = QuestStartTypeValues;
+template<> inline constexpr std::span<const QuestEnumValue> QuestEnumOf<QuestBgmType> = QuestBgmTypeValues;
+template<> inline constexpr std::span<const QuestEnumValue> QuestEnumOf<QuestClearType> = QuestClearTypeValues;
+template<> inline constexpr std::span<const QuestEnumValue> QuestEnumOf<QuestClearParam> = QuestClearParamValues;
+template<> inline constexpr std::span<const QuestEnumValue> QuestEnumOf<QuestCarveLevel> = QuestCarveLevelValues;
+template<> inline constexpr std::span<const QuestEnumValue> QuestEnumOf<QuestGatheringLevel> = QuestGatheringLevelValues;
+template<> inline constexpr std::span<const QuestEnumValue> QuestEnumOf<QuestFishingLevel> = QuestFishingLevelValues;
+
+// Value0 and Value1 alias Value and are left out
+inline constexpr QuestField QuestClearConditionFields[] = {
+    QUEST_FIELD(QuestClearCondition, Param),
+    QUEST_FIELD(QuestClearCondition, Value),
+    QUEST_FIELD(QuestClearCondition, Count),
+};
+
+inline constexpr QuestField QuestSuppliesFields[] = {
+    QUEST_FIELD(QuestSupplies, SuppLabel),
+    QUEST_FIELD(QuestSupplies, SuppType),
+    QUEST_FIELD(QuestSupplies, SuppTarget),
+    QUEST_FIELD(QuestSupplies, SuppTargetCount),
+};
+
+inline constexpr QuestField QuestMonsterFields[] = {
+    QUEST_FIELD(QuestMonster, Id),
+    QUEST_FIELD(QuestMonster, SubType),
+    QUEST_FIELD(QuestMonster, AuraType),
+    QUEST_FIELD(QuestMonster, RestoreAmount),
+    QUEST_FIELD(QuestMonster, HealthTableIndex),
+    QUEST_FIELD(QuestMonster, AttackTableIndex),
+    QUEST_FIELD(QuestMonster, OtherTableIndex),
+    QUEST_FIELD(QuestMonster, Difficulty),
+    QUEST_FIELD(QuestMonster, Size),
+    QUEST_FIELD(QuestMonster, SizeTableIndex),
+    QUEST_FIELD(QuestMonster, StaminaTableIndex),
+};
+
+inline constexpr QuestField QuestEnemySetFields[] = {
+    QUEST_FIELD(QuestEnemySet, SetType),
+    QUEST_FIELD(QuestEnemySet, TargetId),
+    QUEST_FIELD(QuestEnemySet, TargetCount),
+};
+
+inline constexpr QuestField QuestMonsterSpawnFields[] = {
+    QUEST_FIELD(QuestMonsterSpawn, SpawnType),
+    QUEST_FIELD(QuestMonsterSpawn, SpawnTargetType),
+    QUEST_FIELD(QuestMonsterSpawn, SpawnTargetCount),
+};
+
+inline constexpr QuestField QuestInfoFields[] = {
+    QUEST_FIELD(QuestInfo, TypeHash),
+    QUEST_FIELD(QuestInfo, File),
+};
+
+template<> inline constexpr std::span<const QuestField> QuestFieldsOf<QuestClearCondition> = QuestClearConditionFields;
+template<> inline constexpr std::span<const QuestField> QuestFieldsOf<QuestSupplies> = QuestSuppliesFields;
+template<> inline constexpr std::span<const QuestField> QuestFieldsOf<QuestMonster> = QuestMonsterFields;
+template<> inline constexpr std::span<const QuestField> QuestFieldsOf<QuestEnemySet> = QuestEnemySetFields;
+template<> inline constexpr std::span<const QuestField> QuestFieldsOf<QuestMonsterSpawn> = QuestMonsterSpawnFields;
+template<> inline constexpr std::span<const QuestField> QuestFieldsOf<QuestInfo> = QuestInfoFields;
+
+inline constexpr QuestField QuestDataFields[] = {
+    QUEST_FIELD(QuestData, Index),
+    QUEST_FIELD(QuestData, Id),
+    QUEST_FIELD(QuestData, Type),
+    QUEST_FIELD(QuestData, SubType),
+    QUEST_FIELD(QuestData, Level),
+    QUEST_FIELD(QuestData, EnemyLevel),
+    QUEST_FIELD(QuestData, Map),
+    QUEST_FIELD(QuestData, StartType),
+    QUEST_FIELD(QuestData, QuestTime),
+    QUEST_FIELD(QuestData, Faints),
+    QUEST_FIELD(QuestData, ArenaEquipId),
+    QUEST_FIELD(QuestData, BgmType),
+    QUEST_FIELD(QuestData, Requirement1),
+    QUEST_FIELD(QuestData, Requirement2),
+    QUEST_FIELD(QuestData, ComboRequirement),
+    QUEST_FIELD(QuestData, ClearType),
+    QUEST_FIELD(QuestData, GekitaiHp),
+    QUEST_FIELD(QuestData, ClearConditions),
+    QUEST_FIELD(QuestData, SubClearCondition),
+    QUEST_FIELD(QuestData, CarveLevel),
+    QUEST_FIELD(QuestData, GatheringLevel),
+    QUEST_FIELD(QuestData, FishingLevel),
+    QUEST_FIELD(QuestData, Fee),
+    QUEST_FIELD(QuestData, VillagePoints),
+    QUEST_FIELD(QuestData, Reward),
+    QUEST_FIELD(QuestData, SubReward),
+    QUEST_FIELD(QuestData, ClearVillagePoints),
+    QUEST_FIELD(QuestData, FailVillagePoints),
+    QUEST_FIELD(QuestData, SubVillagePoints),
+    QUEST_FIELD(QuestData, HunterRankPoints),
+    QUEST_FIELD(QuestData, SubHunterRankPoints),
+    QUEST_FIELD(QuestData, RemAddFrame),
+    QUEST_FIELD(QuestData, RemAddLotMax),
+    QUEST_FIELD(QuestData, Supplies),
+    QUEST_FIELD(QuestData, Monsters),
+    QUEST_FIELD(QuestData, SmallMonsterHpIndex),
+    QUEST_FIELD(QuestData, SmallMonsterAtkIndex),
+    QUEST_FIELD(QuestData, SmallMonsterOtherIndex),
+    QUEST_FIELD(QuestData, EnemySet2),
+    QUEST_FIELD(QuestData, EnemySet3),
+    QUEST_FIELD(QuestData, BossRushType),
+    QUEST_FIELD(QuestData, MonsterSpawns),
+    QUEST_FIELD(QuestData, StrayRand),
+    QUEST_FIELD(QuestData, StrayStartTime),
+    QUEST_FIELD(QuestData, StrayStartRand),
+    QUEST_FIELD(QuestData, StrayLimit345),
+    QUEST_FIELD(QuestData, StrayRand345),
+    QUEST_FIELD(QuestData, ExtraTicketCount),
+    QUEST_FIELD(QuestData, Icons),
+    QUEST_FIELD(QuestData, ProgNum),
+    QUEST_FIELD(QuestData, Info),
+    QUEST_FIELD(QuestData, VillagePointsG),
+    QUEST_FIELD(QuestData, Flags),
+};
+
+#undef QUEST_FIELD
+
+// True if the fields follow each other without a gap from the start to the end of their struct,
+// the members of nested structs included
+constexpr bool coversQuestStruct(std::span<const QuestField> fields, size_t size)
+{
+    size_t end = 0;
+    for (const auto& field : fields)
+    {
+        if (field.Offset != end)
+            return false;
+
+        if (field.Type == QuestFieldType::Struct && !coversQuestStruct(field.Fields, field.Stride))
+            return false;
+
+        end = field.Offset + (size_t)field.Count * field.Stride;
+    }
+
+    return end == size;
+}
+
+// Every byte of QuestData is covered, so a field added to the struct has to be added here too
+static_assert(coversQuestStruct(QuestDataFields, sizeof(QuestData)));
+
+// A single value of a quest, reached by a path like "Monsters[2].Size"
+class QuestFieldRef
+{
+public:
+    static std::optional<QuestFieldRef> find(std::string_view path);
+
+    // Leaf fields in the order of QuestData, with char arrays as one string field
+    static std::span<const QuestFieldRef> all();
+
+    const QString& path() const { return fieldPath; }
+    QuestFieldType type() const { return fieldType; }
+    u32 offset() const { return fieldOffset; }
+    u32 size() const { return fieldSize; }
+    std::span<const QuestEnumValue> enumValues() const { return field->Enum; }
+
+    // Integer and enum fields, string fields are read through text
+    s32 get(const QuestData& quest) const;
+    void set(QuestData& quest, s32 value) const;
+    QString text(const QuestData& quest) const; // Enum names where known
+
+    bool isValid(const QuestData& quest) const; // False for enum values outside of their set
+
+private:
+    const QuestField* field = nullptr;
+    QString fieldPath;
+    QuestFieldType fieldType = QuestFieldType::U8;
+    u32 fieldOffset = 0;
+    u32 fieldSize = 0;
+};
+
+// Nested like QuestData, with enum names where known
+QJsonObject questDataToJson(const QuestData& quest);
+
+// One "path: old -> new" line per field that differs
+QStringList diffQuestData(const QuestData& a, const QuestData& b);
+
+// One line per field with a value outside of its enum
+QStringList validateQuestData(const QuestData& quest);
+
+}
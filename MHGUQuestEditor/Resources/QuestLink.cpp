@@ -1,25 +1,25 @@
 #include "QuestLink.h"
 #include "Util/Crc32.h"
-
-#include <QDataStream>
+#include "Util/SpanReader.h"
+#include "Util/SpanWriter.h"
 
 Resources::QuestLink Resources::QuestLink::deserialize(const QByteArray& data)
 {
-    QDataStream stream(data);
-    stream.setByteOrder(QDataStream::LittleEndian);
+    return deserialize(std::span((const u8*)data.data(), (size_t)data.size()));
+}
 
-    u32 version;
-    stream >> version;
+Resources::QuestLink Resources::QuestLink::deserialize(std::span<const u8> data)
+{
+    Util::SpanReader reader(data);
 
+    const auto version = reader.read<u32>();
     if (version != Version)
     {
         qCritical("Invalid version %08X", version);
         return {};
     }
 
-    s32 count;
-    stream >> count;
-
+    const auto count = reader.read<s32>();
     if (count > 1)
     {
         qCritical("Multiple Quest Link per Resource is not supported");
@@ -27,25 +27,23 @@ Resources::QuestLink Resources::QuestLink::deserialize(const QByteArray& data)
     }
 
     QuestLink link;
-    stream.readRawData((char*)&link, sizeof(QuestLink));
+    if (!reader.read(link))
+    {
+        qCritical("Truncated QuestLink");
+        return {};
+    }
 
     return link;
 }
 
-Resources::QuestLink Resources::QuestLink::deserialize(std::span<const u8> data)
-{
-    return deserialize(QByteArray((const char*)data.data(), data.size()));
-}
-
 QByteArray Resources::QuestLink::serialize(const QuestLink& link)
 {
-    QByteArray data;
-    QDataStream stream(&data, QIODeviceBase::WriteOnly);
-    stream.setByteOrder(QDataStream::LittleEndian);
+    QByteArray data(sizeof(u32) + sizeof(s32) + sizeof(QuestLink), Qt::Uninitialized);
+    Util::SpanWriter writer(data);
 
-    stream << Version;
-    stream << 1; // Quest Link count
-    stream.writeRawData((const char*)&link, sizeof(QuestLink));
+    writer.write(Version);
+    writer.write<s32>(1); // Quest Link count
+    writer.write(link);
 
     return data;
 }
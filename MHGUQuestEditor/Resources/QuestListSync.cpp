@@ -0,0 +1,95 @@
+#include "QuestListSync.h"
+#include "QuestArc.h"
+
+#include <QtConcurrent/QtConcurrentMap>
+#include <QtLogging>
+
+#include <algorithm>
+
+
+Resources::QuestListSync::Result Resources::QuestListSync::sync(
+    const std::filesystem::path& questList,
+    std::span<const std::filesystem::path> questArcs,
+    const CompressionPolicy& compression)
+{
+    struct Job
+    {
+        std::filesystem::path Path;
+        std::vector<ArcEntry> Entries; // Quest data and GMDs, empty if the quest arc could not be read
+    };
+
+    std::vector<Job> jobs;
+    jobs.reserve(questArcs.size());
+    for (const auto& path : questArcs)
+        jobs.push_back({ .Path = path });
+
+    // Only the merged entries are ever touched, so mapping the quest arcs avoids reading the rest of them.
+    // Their payloads are copied out and the arc is closed again, so only a few files are open at a time.
+    auto loads = QtConcurrent::map(jobs, [](Job& job) {
+        const QuestArc arc(job.Path, true, Arc::LoadMode::Mapped);
+        const auto& entries = arc.getEntries();
+
+        const auto hasQuestData = std::ranges::any_of(entries, [](const ArcEntry& entry) { return entry.Extension == ".ext"; });
+        if (!hasQuestData)
+            return;
+
+        for (const auto& entry : entries)
+        {
+            if (entry.Extension != ".ext" && entry.Extension != ".gmd")
+                continue;
+
+            auto& copy = job.Entries.emplace_back(entry);
+            copy.setRawData({ entry.RawData.begin(), entry.RawData.end() });
+        }
+    });
+
+    QuestArc list(questList, false, Arc::LoadMode::Mapped);
+    loads.waitForFinished();
+
+    Result result;
+
+    if (list.getEntries().empty())
+    {
+        qCritical("Failed to load quest list %s", questList.string().c_str());
+        return result;
+    }
+
+    for (const auto& job : jobs)
+    {
+        if (job.Entries.empty())
+        {
+            result.Failed.push_back(job.Path);
+            continue;
+        }
+
+        for (const auto& entry : job.Entries)
+            list.copyRawEntry(entry);
+
+        result.Merged++;
+    }
+
+    if (result.Merged == 0)
+    {
+        return result;
+    }
+
+    list.setCompressionPolicy(compression);
+    result.Saved = list.saveIncremental();
+
+    return result;
+}
+
+std::vector<std::filesystem::path> Resources::QuestListSync::findQuestArcs(const std::filesystem::path& folder)
+{
+    std::vector<std::filesystem::path> questArcs;
+
+    std::error_code ec;
+    for (const auto& file : std::filesystem::directory_iterator(folder, ec))
+    {
+        if (file.is_regular_file(ec) && file.path().extension() == ".arc" && QuestArc::isQuestArcPath(file.path()))
+            questArcs.push_back(file.path());
+    }
+
+    std::ranges::sort(questArcs);
+    return questArcs;
+}
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <Common.h>
+#include "Compression.h"
+
+#include <filesystem>
+#include <span>
+#include <vector>
+
+
+namespace Resources
+{
+
+// Merges the quest data and GMDs of many quest arcs into a quest list in one pass.
+// The quest arcs are read in parallel, the quest list is loaded and saved only once.
+class QuestListSync
+{
+public:
+    struct Result
+    {
+        size_t Merged = 0;
+        std::vector<std::filesystem::path> Failed; // Quest arcs that could not be read
+        bool Saved = false;
+    };
+
+    static Result sync(
+        const std::filesystem::path& questList,
+        std::span<const std::filesystem::path> questArcs,
+        const CompressionPolicy& compression = {}
+    );
+
+    // Every qXXXXXXX.arc directly inside the given folder
+    static std::vector<std::filesystem::path> findQuestArcs(const std::filesystem::path& folder);
+};
+
+}
@@ -0,0 +1,94 @@
+#include "QuestSnapshot.h"
+
+#include <QtLogging>
+
+#include <algorithm>
+
+
+void Resources::QuestSnapshot::load(QPromise<std::shared_ptr<QuestSnapshot>>& promise, const std::filesystem::path& path)
+{
+    // Reading the arc, the quest data and link, every GMD, rem, em set list and boss set
+    constexpr int steps = 3 + Language::Count + 5 + 3 + 5;
+    int step = 0;
+
+    promise.setProgressRange(0, steps);
+
+    const auto advance = [&] {
+        promise.setProgressValue(++step);
+        return !promise.isCanceled();
+    };
+
+    auto snapshot = std::make_shared<QuestSnapshot>();
+    snapshot->Arc = std::make_unique<QuestArc>(path);
+
+    const auto& entries = snapshot->Arc->getEntries();
+    const auto hasEntry = [&entries](const char* extension) {
+        return std::ranges::any_of(entries, [extension](const ArcEntry& entry) { return entry.Extension == extension; });
+    };
+
+    if (!hasEntry(".ext") || !hasEntry(".qdl"))
+    {
+        qCritical("Not a valid quest arc %s", path.string().c_str());
+        return;
+    }
+
+    if (!advance())
+        return;
+
+    auto& arc = *snapshot->Arc;
+    snapshot->Data = QuestData::deserialize(arc.getDataView(arc.getQuestData()));
+    if (!advance())
+        return;
+
+    for (s32 language = Language::Eng; language < Language::Count; ++language)
+    {
+        const auto gmdEntry = arc.getGmd(language, snapshot->Data.Info[language].File);
+        if (gmdEntry)
+            snapshot->Gmds[language] = Gmd::deserialize(arc.getDataView(*gmdEntry));
+        else
+            qCritical("Failed to find GMD for language %d", language);
+
+        if (!advance())
+            return;
+    }
+
+    snapshot->Link = QuestLink::deserialize(arc.getDataView(arc.getQuestLink()));
+    const auto resources = snapshot->Link.resolve(arc);
+    if (!advance())
+        return;
+
+    const ArcEntry* rems[] = {
+        resources.RemMain[0], resources.RemMain[1],
+        resources.RemAdd[0], resources.RemAdd[1],
+        resources.RemSub
+    };
+
+    for (auto i = 0; i < snapshot->Rems.size(); ++i)
+    {
+        if (rems[i])
+            snapshot->Rems[i] = Rem::deserialize(arc.getDataView(*rems[i]));
+
+        if (!advance())
+            return;
+    }
+
+    for (auto i = 0; i < snapshot->EmSetLists.size(); ++i)
+    {
+        if (resources.EmSetList[i])
+            snapshot->EmSetLists[i] = EmSetList::deserialize(arc.getDataView(*resources.EmSetList[i]));
+
+        if (!advance())
+            return;
+    }
+
+    for (auto i = 0; i < snapshot->BossSets.size(); ++i)
+    {
+        if (resources.BossSet[i])
+            snapshot->BossSets[i] = BossSet::deserialize(arc.getDataView(*resources.BossSet[i]));
+
+        if (!advance())
+            return;
+    }
+
+    promise.addResult(std::move(snapshot));
+}
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <Common.h>
+#include "BossSet.h"
+#include "EmSetList.h"
+#include "Gmd.h"
+#include "QuestArc.h"
+#include "QuestData.h"
+#include "QuestLink.h"
+#include "Rem.h"
+
+#include <QPromise>
+
+#include <array>
+#include <filesystem>
+#include <memory>
+#include <optional>
+
+
+namespace Resources
+{
+
+// Everything the editor shows of a quest arc, parsed in one go so it can happen off the UI thread.
+// Once loaded, the snapshot is only handed over and never touched by the loader again.
+struct QuestSnapshot
+{
+    std::unique_ptr<QuestArc> Arc;
+    QuestData Data;
+    QuestLink Link;
+    std::array<std::optional<Gmd>, Language::Count> Gmds; // Empty if the language's GMD is missing
+    std::array<Rem, 5> Rems; // MainA, MainB, ExtraA, ExtraB, Sub
+    std::array<std::optional<EmSetList>, 3> EmSetLists;
+    std::array<std::optional<Spawn>, 5> BossSets;
+
+    // Reports progress and checks for cancellation between files. No result is added if the
+    // load was canceled or the arc is not a valid quest arc.
+    static void load(QPromise<std::shared_ptr<QuestSnapshot>>& promise, const std::filesystem::path& path);
+};
+
+}
@@ -1,6 +1,7 @@
 #include "Rem.h"
 
-#include <QDataStream>
+#include "Util/SpanReader.h"
+#include "Util/SpanWriter.h"
 
 
 size_t Resources::Rem::size() const
@@ -60,47 +61,45 @@ size_t Resources::Rem::add(const RewardEntry& entry)
 
 Resources::Rem Resources::Rem::deserialize(const QByteArray& data)
 {
-    QDataStream stream(data);
-    stream.setByteOrder(QDataStream::LittleEndian);
+    return deserialize(std::span((const u8*)data.data(), (size_t)data.size()));
+}
 
-    u32 version;
-    stream >> version;
+Resources::Rem Resources::Rem::deserialize(std::span<const u8> data)
+{
+    Util::SpanReader reader(data);
 
+    const auto version = reader.read<u32>();
     if (version != Version)
     {
         qCritical("Invalid version %08X", version);
         return {};
     }
 
-    s32 remCount;
-    stream >> remCount;
-
-    if (remCount > 1) 
+    const auto remCount = reader.read<s32>();
+    if (remCount > 1)
     {
         qCritical("Multiple Rem per Resource is not supported");
         return {};
     }
 
     Rem rem;
-    stream.readRawData((char*)&rem, sizeof(Rem));
+    if (!reader.read(rem))
+    {
+        qCritical("Truncated Rem");
+        return {};
+    }
 
     return rem;
 }
 
-Resources::Rem Resources::Rem::deserialize(std::span<const u8> data)
-{
-    return deserialize(QByteArray((const char*)data.data(), data.size()));
-}
-
 QByteArray Resources::Rem::serialize(const Rem& rem)
 {
-    QByteArray data;
-    QDataStream stream(&data, QIODeviceBase::WriteOnly);
-    stream.setByteOrder(QDataStream::LittleEndian);
-
-    stream << Version;
-    stream << 1; // Rem count
-    stream.writeRawData((const char*)&rem, sizeof(Rem));
-    
+    QByteArray data(sizeof(u32) + sizeof(s32) + sizeof(Rem), Qt::Uninitialized);
+    Util::SpanWriter writer(data);
+
+    writer.write(Version);
+    writer.write<s32>(1); // Rem count
+    writer.write(rem);
+
     return data;
 }
@@ -1,16 +1,21 @@
 #include "StatTable.h"
 
-#include <QDataStream>
+#include "Util/SpanReader.h"
+
+#include <cstring>
 
 
 Resources::StatTable Resources::StatTable::deserialize(const QByteArray& data)
 {
-    QDataStream stream(data);
-    stream.setByteOrder(QDataStream::LittleEndian);
+    return deserialize(std::span((const u8*)data.data(), (size_t)data.size()));
+}
 
-    u32 magic, version;
-    stream >> magic;
-    stream >> version;
+Resources::StatTable Resources::StatTable::deserialize(std::span<const u8> data)
+{
+    Util::SpanReader reader(data);
+
+    const auto magic = reader.read<u32>();
+    const auto version = reader.read<u32>();
 
     if (magic != Magic)
     {
@@ -24,18 +29,21 @@ Resources::StatTable Resources::StatTable::deserialize(const QByteArray& data)
         return {};
     }
 
-    int count;
-    stream >> count;
-    stream.skipRawData(4); // Padding
-
-    StatTable table;
+    const auto count = reader.read<s32>();
+    reader.skip(4); // Padding
 
-    for (int i = 0; i < count; ++i)
+    if (count < 0 || (size_t)count > reader.remaining() / sizeof(StatTableEntry))
     {
-        StatTableEntry entry;
-        stream.readRawData((char*)&entry, sizeof(StatTableEntry));
-        table.entries.emplace_back(entry);
+        qCritical("Invalid entry count %d", count);
+        return {};
     }
 
+    StatTable table;
+    table.entries.resize(count);
+
+    const auto entries = reader.readBytes(count * sizeof(StatTableEntry));
+    if (!entries.empty())
+        std::memcpy(table.entries.data(), entries.data(), entries.size());
+
     return table;
 }
@@ -3,6 +3,7 @@
 #include <Common.h>
 
 #include <QByteArray>
+#include <span>
 #include <vector>
 
 namespace Resources
@@ -41,6 +42,7 @@ public:
     }
 
     static StatTable deserialize(const QByteArray& data);
+    static StatTable deserialize(std::span<const u8> data);
 };
 
 }
@@ -2,19 +2,21 @@
 
 #include <QFileDialog>
 
-SettingsDialog::SettingsDialog(QWidget *parent, QString questList, bool autoUpdate)
-    : QDialog(parent), questListPath(std::move(questList)), autoUpdateQuestList(autoUpdate)
+SettingsDialog::SettingsDialog(QWidget *parent, QString questList, bool autoUpdate, Resources::CompressionPolicy::Preset compression)
+    : QDialog(parent), questListPath(std::move(questList)), autoUpdateQuestList(autoUpdate), compressionPreset(compression)
 {
     ui.setupUi(this);
 
     ui.textQuestList->setText(questListPath);
     ui.checkBoxAutoUpdate->setChecked(autoUpdateQuestList);
+    ui.comboCompression->setCurrentIndex((int)compressionPreset);
 
     connect(ui.buttonBrowseQuestList, &QToolButton::clicked, this, &SettingsDialog::browseForQuestList);
     connect(ui.cancelButton, &QPushButton::clicked, this, &SettingsDialog::reject);
     connect(ui.okButton, &QPushButton::clicked, this, [this] {
         questListPath = ui.textQuestList->text();
         autoUpdateQuestList = ui.checkBoxAutoUpdate->isChecked();
+        compressionPreset = (Resources::CompressionPolicy::Preset)ui.comboCompression->currentIndex();
         accept();
     });
 }
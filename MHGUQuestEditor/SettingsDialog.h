@@ -3,17 +3,20 @@
 #include <QDialog>
 #include <QSettings>
 #include "ui_SettingsDialog.h"
+#include "Resources/Compression.h"
 
 class SettingsDialog : public QDialog
 {
     Q_OBJECT
 
 public:
-    SettingsDialog(QWidget* parent = nullptr, QString questList = {}, bool autoUpdate = false);
+    SettingsDialog(QWidget* parent = nullptr, QString questList = {}, bool autoUpdate = false,
+        Resources::CompressionPolicy::Preset compression = Resources::CompressionPolicy::Preset::Default);
     ~SettingsDialog();
 
     QString getQuestListPath() const { return questListPath; }
     bool getAutoUpdateQuestList() const { return autoUpdateQuestList; }
+    Resources::CompressionPolicy::Preset getCompressionPreset() const { return compressionPreset; }
 
 private:
     void browseForQuestList();
@@ -23,4 +26,5 @@ private:
 
     QString questListPath;
     bool autoUpdateQuestList;
+    Resources::CompressionPolicy::Preset compressionPreset;
 };
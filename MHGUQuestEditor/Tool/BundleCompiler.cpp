@@ -0,0 +1,250 @@
+// Compiles the editor's lookup data in res/*.json into the data bundle read at startup.
+// Only the fields the editor uses are kept, see Resources/DataBundle.h for the format.
+
+#include "Resources/DataBundle.h"
+
+#include <QCoreApplication>
+#include <QDir>
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QSaveFile>
+
+#include <optional>
+
+namespace
+{
+
+using Resources::DataBundleBuilder;
+
+std::optional<QJsonDocument> readJson(const QDir& root, const QString& name)
+{
+    QFile file(root.filePath(name + ".json"));
+    if (!file.open(QIODevice::ReadOnly))
+    {
+        qCritical("Failed to open %s", qUtf8Printable(file.fileName()));
+        return std::nullopt;
+    }
+
+    QJsonParseError error;
+    const auto document = QJsonDocument::fromJson(file.readAll(), &error);
+    if (error.error != QJsonParseError::NoError)
+    {
+        qCritical("Failed to parse %s: %s", qUtf8Printable(file.fileName()), qUtf8Printable(error.errorString()));
+        return std::nullopt;
+    }
+
+    return document;
+}
+
+void addString(DataBundleBuilder& builder, const QJsonValue& value)
+{
+    builder.addString(value.toString().toStdString());
+}
+
+// ["Name", ...] -> Name
+void addStringList(DataBundleBuilder& builder, const QString& name, const QJsonDocument& document)
+{
+    builder.beginTable(name.toStdString(), 1);
+    for (const auto value : document.array())
+        addString(builder, value);
+}
+
+// [{ "Name": ..., "Value": ... }, ...] -> Name, Value
+void addNamedValues(DataBundleBuilder& builder, const QString& name, const QJsonDocument& document)
+{
+    builder.beginTable(name.toStdString(), 2);
+    for (const auto value : document.array())
+    {
+        const auto obj = value.toObject();
+        addString(builder, obj["Name"]);
+        builder.addInteger(obj["Value"].toInt());
+    }
+}
+
+// { "Name": Id, ... } -> Name, Id, in the sorted order of the object's keys
+void addNamedIds(DataBundleBuilder& builder, const QString& name, const QJsonDocument& document)
+{
+    const auto obj = document.object();
+
+    builder.beginTable(name.toStdString(), 2);
+    for (const auto& key : obj.keys())
+    {
+        builder.addString(key.toStdString());
+        builder.addInteger(obj[key].toInt());
+    }
+}
+
+// { "Name": { "Id": ..., "BaseHp": ... }, ... } -> Name, Id, BaseHp
+void addMonsters(DataBundleBuilder& builder, const QString& name, const QJsonDocument& document)
+{
+    const auto obj = document.object();
+
+    builder.beginTable(name.toStdString(), 3);
+    for (const auto& key : obj.keys())
+    {
+        const auto data = obj[key].toObject();
+        builder.addString(key.toStdString());
+        builder.addInteger(data["Id"].toInt());
+        builder.addInteger(data["BaseHp"].toInt());
+    }
+}
+
+// spawn_areas: MapId, Area, FirstSpawn, SpawnCount
+// spawns: RoundNo, Angle, X, Y, Z
+void addSpawns(DataBundleBuilder& builder, const QString&, const QJsonDocument& document)
+{
+    const auto maps = document.array();
+
+    builder.beginTable("spawn_areas", 4);
+    s32 first = 0;
+    for (const auto map : maps)
+    {
+        const auto obj = map.toObject();
+        for (const auto area : obj["areas"].toArray())
+        {
+            const auto areaObj = area.toObject();
+            const auto count = (s32)areaObj["spawns"].toArray().size();
+            builder.addInteger(obj["map_id"].toInt());
+            builder.addInteger(areaObj["area"].toInt());
+            builder.addInteger(first);
+            builder.addInteger(count);
+            first += count;
+        }
+    }
+
+    builder.beginTable("spawns", 5);
+    for (const auto map : maps)
+    {
+        for (const auto area : map.toObject()["areas"].toArray())
+        {
+            for (const auto spawn : area.toObject()["spawns"].toArray())
+            {
+                const auto obj = spawn.toObject();
+                builder.addInteger(obj["round_no"].toInt());
+                builder.addNumber((float)obj["angle"].toDouble());
+                builder.addNumber((float)obj["x"].toDouble());
+                builder.addNumber((float)obj["y"].toDouble());
+                builder.addNumber((float)obj["z"].toDouble());
+            }
+        }
+    }
+}
+
+// Id, MaxLevel, then whether the series has a head, chest, arm, waist and leg piece
+void addArmorSeries(DataBundleBuilder& builder, const QString& name, const QJsonDocument& document)
+{
+    builder.beginTable(name.toStdString(), 7);
+    for (const auto armor : document.array())
+    {
+        const auto obj = armor.toObject();
+        builder.addInteger(obj["Id"].toInt());
+        builder.addInteger(obj["MaxLevel"].toInt());
+
+        const auto pieces = obj["Pieces"].toArray();
+        for (auto i = 0; i < 5; ++i)
+            builder.addInteger(pieces[i].toInt());
+    }
+}
+
+// weapon_types: Type, FirstWeapon, WeaponCount
+// weapons: Name, Family, Level
+void addWeapons(DataBundleBuilder& builder, const QString&, const QJsonDocument& document)
+{
+    const auto types = document.array();
+
+    builder.beginTable("weapon_types", 3);
+    s32 first = 0;
+    for (const auto type : types)
+    {
+        const auto obj = type.toObject();
+        const auto count = (s32)obj["Weapons"].toArray().size();
+        addString(builder, obj["Type"]);
+        builder.addInteger(first);
+        builder.addInteger(count);
+        first += count;
+    }
+
+    builder.beginTable("weapons", 3);
+    for (const auto type : types)
+    {
+        for (const auto weapon : type.toObject()["Weapons"].toArray())
+        {
+            const auto obj = weapon.toObject();
+            addString(builder, obj["Name"]);
+            builder.addInteger(obj["Family"].toInt());
+            builder.addInteger(obj["Level"].toInt());
+        }
+    }
+}
+
+struct Source
+{
+    const char* Name;
+    void (*Add)(DataBundleBuilder& builder, const QString& name, const QJsonDocument& document);
+};
+
+const Source Sources[] = {
+    { "icon_names", &addStringList },
+    { "item_names", &addStringList },
+    { "skill_names", &addStringList },
+    { "quest_type", &addStringList },
+    { "quest_subtype", &addStringList },
+    { "quest_start_type", &addStringList },
+    { "quest_bgm", &addStringList },
+    { "quest_requirement", &addStringList },
+    { "quest_clear_type", &addStringList },
+    { "quest_objective", &addStringList },
+    { "quest_carve_level", &addStringList },
+    { "quest_gather_level", &addStringList },
+    { "quest_fishing_level", &addStringList },
+    { "quest_level", &addNamedValues },
+    { "em_level", &addNamedValues },
+    { "map_names", &addNamedValues },
+    { "ems_names", &addNamedIds },
+    { "hunter_arts", &addNamedIds },
+    { "em_names", &addMonsters },
+    { "spawns", &addSpawns },
+    { "armor_series_data", &addArmorSeries },
+    { "weapons", &addWeapons },
+};
+
+}
+
+int main(int argc, char* argv[])
+{
+    QCoreApplication app(argc, argv);
+
+    const auto args = QCoreApplication::arguments();
+    if (args.size() != 3)
+    {
+        qCritical("Usage: MHGUBundleCompiler <res folder> <output>");
+        return 1;
+    }
+
+    const QDir root(args[1]);
+    DataBundleBuilder builder;
+
+    for (const auto& source : Sources)
+    {
+        const auto document = readJson(root, source.Name);
+        if (!document)
+            return 1;
+
+        source.Add(builder, source.Name, *document);
+    }
+
+    const auto data = builder.build();
+    if (!data)
+        return 1;
+
+    QSaveFile file(args[2]);
+    if (!file.open(QIODevice::WriteOnly) || file.write(*data) != data->size() || !file.commit())
+    {
+        qCritical("Failed to write %s", qUtf8Printable(args[2]));
+        return 1;
+    }
+
+    return 0;
+}
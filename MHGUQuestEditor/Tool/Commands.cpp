@@ -0,0 +1,568 @@
+#include "Commands.h"
+
+#include "Resources/Arc.h"
+#include "Resources/ExtensionResolver.h"
+#include "Resources/Gmd.h"
+#include "Resources/QuestData.h"
+#include "Resources/QuestDataFields.h"
+
+#include <QDataStream>
+#include <QDir>
+#include <QDirIterator>
+#include <QElapsedTimer>
+#include <QFile>
+#include <QFileInfo>
+#include <QJsonDocument>
+#include <QTextStream>
+#include <QtLogging>
+
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <optional>
+#include <span>
+#include <string>
+#include <utility>
+
+namespace
+{
+
+constexpr auto ManifestName = "arc_manifest.txt";
+
+std::filesystem::path toPath(const QString& path)
+{
+    return path.toStdWString();
+}
+
+// Arc paths use backslashes, accept either on the command line
+QString toEntryPath(QString path)
+{
+    return path.replace('/', '\\');
+}
+
+// Entry paths come from the arc or the manifest, anything that would end up outside of root is rejected
+std::optional<QString> toFilePath(const QDir& root, const QString& entryPath)
+{
+    const auto path = QDir::cleanPath(QString(entryPath).replace('\\', '/'));
+    if (path.isEmpty() || QDir::isAbsolutePath(path) || path.contains(':') || path == ".." || path.startsWith("../"))
+    {
+        qCritical("%s points outside of %s", qUtf8Printable(entryPath), qUtf8Printable(root.path()));
+        return std::nullopt;
+    }
+
+    return root.filePath(path);
+}
+
+bool writeFile(const QString& path, std::span<const u8> data)
+{
+    QDir().mkpath(QFileInfo(path).absolutePath());
+
+    QFile file(path);
+    if (!file.open(QIODevice::WriteOnly) || file.write((const char*)data.data(), (qint64)data.size()) != (qint64)data.size())
+    {
+        qCritical("Failed to write %s", qUtf8Printable(path));
+        return false;
+    }
+
+    return true;
+}
+
+std::optional<QByteArray> readFile(const QString& path)
+{
+    QFile file(path);
+    if (!file.open(QIODevice::ReadOnly))
+    {
+        qCritical("Failed to open %s", qUtf8Printable(path));
+        return std::nullopt;
+    }
+
+    return file.readAll();
+}
+
+std::optional<Resources::Arc> loadArc(const QString& path)
+{
+    if (!QFile::exists(path))
+    {
+        qCritical("%s does not exist", qUtf8Printable(path));
+        return std::nullopt;
+    }
+
+    Resources::Arc arc(toPath(path), Resources::Arc::LoadMode::Mapped);
+    if (arc.getEntries().empty())
+    {
+        qCritical("Failed to load %s", qUtf8Printable(path));
+        return std::nullopt;
+    }
+
+    return arc;
+}
+
+// Quest data either comes straight from a quest file or from the quest data entry of a quest arc
+std::optional<Resources::QuestData> loadQuestData(const QString& path)
+{
+    QByteArray data;
+
+    if (path.endsWith(".arc"))
+    {
+        const auto arc = loadArc(path);
+        if (!arc)
+            return std::nullopt;
+
+        const auto& entries = arc->getEntries();
+        const auto entry = std::ranges::find(entries, ".ext", &Resources::ArcEntry::Extension);
+        if (entry == entries.end())
+        {
+            qCritical("%s does not contain quest data", qUtf8Printable(path));
+            return std::nullopt;
+        }
+
+        const auto view = arc->getDataView(*entry);
+        data = QByteArray((const char*)view.data(), (qsizetype)view.size());
+    }
+    else
+    {
+        auto file = readFile(path);
+        if (!file)
+            return std::nullopt;
+
+        data = std::move(*file);
+    }
+
+    u32 magic = 0;
+    if (data.size() >= sizeof(magic))
+        std::memcpy(&magic, data.data(), sizeof(magic));
+
+    if (magic != Resources::QuestData::Magic)
+    {
+        qCritical("%s is not a quest file", qUtf8Printable(path));
+        return std::nullopt;
+    }
+
+    return Resources::QuestData::deserialize(data);
+}
+
+// Throughput and ratio of every level of every available backend
+void benchCompression(QTextStream& out, std::span<const Resources::PayloadView> payloads)
+{
+    size_t totalSize = 0;
+    for (const auto& payload : payloads)
+        totalSize += payload.size();
+
+    out << QString("Compression of %1 entries, %2 bytes\n").arg(payloads.size()).arg(totalSize);
+
+    using Backend = Resources::CompressionPolicy::Backend;
+    for (const auto [backend, name] : { std::pair(Backend::Zlib, "zlib"), std::pair(Backend::Libdeflate, "libdeflate") })
+    {
+        if (!Resources::CompressionPolicy::isAvailable(backend))
+            continue;
+
+        Resources::CompressionPolicy policy = { .Engine = backend };
+        for (policy.Level = 0; policy.Level <= policy.maxLevel(); policy.Level++)
+        {
+            size_t compressedSize = 0;
+            QElapsedTimer timer;
+            timer.start();
+
+            for (const auto& payload : payloads)
+                compressedSize += policy.compress(payload).size();
+
+            const auto nsecs = std::max<qint64>(timer.nsecsElapsed(), 1);
+            out << QString("  %1 level %2: %3 MB/s, ratio %4\n")
+                .arg(name, -10)
+                .arg(policy.Level, 2)
+                .arg(totalSize * 1000.0 / nsecs, 8, 'f', 1)
+                .arg(totalSize ? (double)compressedSize / totalSize : 0.0, 0, 'f', 3);
+        }
+    }
+}
+
+// Lookups go through the path index, a large arc shows whether that stays flat
+bool benchLookup(QTextStream& out)
+{
+    constexpr int lookupEntries = 10000;
+    constexpr int lookupRounds = 10;
+    constexpr u32 lookupTypeHash = 0;
+
+    auto arc = Resources::Arc::create({});
+    QStringList paths;
+    paths.reserve(lookupEntries);
+
+    for (int i = 0; i < lookupEntries; i++)
+    {
+        paths.push_back(QString(R"(bench\entry_%1)").arg(i, 5, 10, QChar('0')));
+        arc.addEntry(paths.back(), lookupTypeHash, std::span<const u8>());
+    }
+
+    size_t found = 0;
+    QElapsedTimer timer;
+    timer.start();
+
+    for (int round = 0; round < lookupRounds; round++)
+    {
+        for (const auto& path : paths)
+            found += std::as_const(arc).findEntry(path) != nullptr;
+    }
+
+    const auto nsecs = timer.nsecsElapsed();
+    if (found != (size_t)lookupEntries * lookupRounds)
+    {
+        qCritical("Lookup found %zu of %d entries", found / lookupRounds, lookupEntries);
+        return false;
+    }
+
+    out << QString("Lookup in %1 entries: %2 ns per lookup\n")
+        .arg(lookupEntries)
+        .arg((double)nsecs / ((double)lookupEntries * lookupRounds), 0, 'f', 1);
+
+    return true;
+}
+
+// The GMD parser as it was before strings were parsed in bulk, kept as the reference to compare
+// against. It reads every string a byte at a time through QDataStream and ignores labels.
+size_t parseGmdByteWise(std::span<const u8> data)
+{
+    const QByteArray bytes((const char*)data.data(), (qsizetype)data.size());
+    QDataStream stream(bytes);
+    stream.setByteOrder(QDataStream::LittleEndian);
+
+    u32 magic;
+    stream >> magic;
+    if (magic != Resources::GmdHeader::Magic)
+        return 0;
+
+    Resources::GmdHeader header;
+    stream.readRawData((char*)&header, sizeof(Resources::GmdHeader));
+
+    std::string packageName(header.PackageNameLength + 1, '\0');
+    stream.readRawData(packageName.data(), header.PackageNameLength + 1);
+
+    std::vector<std::string> entries;
+    for (u32 i = 0; i < header.StringCount && !stream.atEnd(); ++i)
+    {
+        std::string entry;
+        char c;
+        do
+        {
+            if (stream.readRawData(&c, 1) != 1)
+                break;
+
+            if (c != '\0')
+                entry.push_back(c);
+        } while (c != '\0');
+
+        entries.push_back(std::move(entry));
+    }
+
+    return entries.size();
+}
+
+// Times Gmd::deserialize against the byte-at-a-time reference on the same files
+void benchGmdParse(QTextStream& out, std::span<const Resources::PayloadView> gmds)
+{
+    if (gmds.empty())
+    {
+        out << "No GMD entries to parse\n";
+        return;
+    }
+
+    constexpr int parseRounds = 100;
+
+    const auto measure = [&](const char* name, auto&& parse) {
+        size_t strings = 0;
+        QElapsedTimer timer;
+        timer.start();
+
+        for (int round = 0; round < parseRounds; round++)
+        {
+            for (const auto& gmd : gmds)
+                strings += parse(gmd);
+        }
+
+        out << QString("  %1: %2 us per file, %3 strings\n")
+            .arg(name, -10)
+            .arg(timer.nsecsElapsed() / 1000.0 / ((double)gmds.size() * parseRounds), 8, 'f', 1)
+            .arg(strings / parseRounds);
+    };
+
+    out << QString("GMD parse of %1 files\n").arg(gmds.size());
+    measure("current", [](std::span<const u8> data) { return Resources::Gmd::deserialize(data).size(); });
+    measure("reference", [](std::span<const u8> data) { return parseGmdByteWise(data); });
+}
+
+}
+
+int Tool::list(const QStringList& args, const Options&)
+{
+    const auto arc = loadArc(args[0]);
+    if (!arc)
+        return 1;
+
+    QTextStream out(stdout);
+    for (const auto& entry : arc->getEntries())
+    {
+        out << QString("%1 %2 %3 %4 %5\n")
+            .arg(entry.Path, -64)
+            .arg(entry.Extension, -12)
+            .arg(entry.CompSize, 10)
+            .arg((u32)entry.RealSize, 10)
+            .arg((u32)entry.Quality);
+    }
+
+    return 0;
+}
+
+int Tool::unpack(const QStringList& args, const Options&)
+{
+    const auto arc = loadArc(args[0]);
+    if (!arc)
+        return 1;
+
+    const QDir root(args[1]);
+    if (!root.mkpath("."))
+    {
+        qCritical("Failed to create %s", qUtf8Printable(args[1]));
+        return 1;
+    }
+
+    // Keeps order, types and quality so the folder can be packed back into an identical arc
+    QFile manifest(root.filePath(ManifestName));
+    if (!manifest.open(QIODevice::WriteOnly | QIODevice::Text))
+    {
+        qCritical("Failed to write %s", qUtf8Printable(manifest.fileName()));
+        return 1;
+    }
+
+    QTextStream manifestStream(&manifest);
+
+    for (const auto& entry : arc->getEntries())
+    {
+        const auto filePath = toFilePath(root, entry.Path + entry.Extension);
+        if (!filePath)
+            return 1;
+
+        const auto data = arc->getDataView(entry);
+        if (data.empty() && entry.RealSize != 0)
+        {
+            qCritical("Failed to decompress %s", qUtf8Printable(entry.Path));
+            return 1;
+        }
+
+        if (!writeFile(*filePath, data))
+            return 1;
+
+        manifestStream << QString("%1\t%2\t%3\n").arg(entry.Path).arg(entry.TypeHash, 8, 16, QChar('0')).arg((u32)entry.Quality);
+    }
+
+    return 0;
+}
+
+int Tool::pack(const QStringList& args, const Options& options)
+{
+    const QDir root(args[0]);
+    if (!root.exists())
+    {
+        qCritical("%s does not exist", qUtf8Printable(args[0]));
+        return 1;
+    }
+
+    auto arc = Resources::Arc::create(toPath(args[1]));
+    arc.setCompressionPolicy(options.Compression);
+
+    const auto addFile = [&](const QString& path, const QString& filePath, u32 typeHash, u32 quality) {
+        const auto data = readFile(filePath);
+        if (!data)
+            return false;
+
+        auto& entry = arc.addEntry(path, typeHash, std::span((const u8*)data->data(), (size_t)data->size()));
+        entry.Quality = quality;
+        return true;
+    };
+
+    QFile manifest(root.filePath(ManifestName));
+    if (manifest.open(QIODevice::ReadOnly | QIODevice::Text))
+    {
+        QTextStream manifestStream(&manifest);
+        while (!manifestStream.atEnd())
+        {
+            const auto line = manifestStream.readLine();
+            if (line.isEmpty())
+                continue;
+
+            const auto fields = line.split('\t');
+            bool ok = fields.size() == 3;
+            const auto typeHash = ok ? fields[1].toUInt(&ok, 16) : 0;
+            const auto quality = ok ? fields[2].toUInt(&ok) : 0;
+            if (!ok)
+            {
+                qCritical("Malformed manifest line: %s", qUtf8Printable(line));
+                return 1;
+            }
+
+            const auto filePath = toFilePath(root, fields[0] + Resources::ExtensionResolver::resolve(typeHash));
+            if (!filePath || !addFile(fields[0], *filePath, typeHash, quality))
+                return 1;
+        }
+    }
+    else
+    {
+        // Without a manifest the type of each file has to be inferred from its extension
+        QStringList files;
+        QDirIterator it(root.path(), QDir::Files, QDirIterator::Subdirectories);
+        while (it.hasNext())
+            files.push_back(root.relativeFilePath(it.next()));
+
+        files.sort();
+
+        for (const auto& file : files)
+        {
+            const auto nameStart = file.lastIndexOf('/') + 1;
+            const auto extensionStart = file.indexOf('.', nameStart);
+            if (extensionStart < 0)
+            {
+                qCritical("%s has no extension", qUtf8Printable(file));
+                return 1;
+            }
+
+            const auto typeHash = Resources::ExtensionResolver::resolveHash(file.sliced(extensionStart));
+            if (!typeHash)
+            {
+                qCritical("Cannot tell the type of %s, pack it with a manifest instead", qUtf8Printable(file));
+                return 1;
+            }
+
+            if (!addFile(toEntryPath(file.first(extensionStart)), root.filePath(file), *typeHash, 2))
+                return 1;
+        }
+    }
+
+    return arc.save() ? 0 : 1;
+}
+
+int Tool::extract(const QStringList& args, const Options&)
+{
+    const auto arc = loadArc(args[0]);
+    if (!arc)
+        return 1;
+
+    const auto entry = arc->findEntry(toEntryPath(args[1]));
+    if (!entry)
+    {
+        qCritical("%s does not contain %s", qUtf8Printable(args[0]), qUtf8Printable(args[1]));
+        return 1;
+    }
+
+    const auto data = arc->getDataView(*entry);
+    if (data.empty() && entry->RealSize != 0)
+    {
+        qCritical("Failed to decompress %s", qUtf8Printable(entry->Path));
+        return 1;
+    }
+
+    return writeFile(args[2], data) ? 0 : 1;
+}
+
+int Tool::replace(const QStringList& args, const Options& options)
+{
+    auto arc = loadArc(args[0]);
+    if (!arc)
+        return 1;
+
+    const auto entry = arc->findEntry(toEntryPath(args[1]));
+    if (!entry)
+    {
+        qCritical("%s does not contain %s", qUtf8Printable(args[0]), qUtf8Printable(args[1]));
+        return 1;
+    }
+
+    const auto data = readFile(args[2]);
+    if (!data)
+        return 1;
+
+    entry->setData(*data);
+    arc->setCompressionPolicy(options.Compression);
+    return arc->save() ? 0 : 1;
+}
+
+int Tool::convert(const QStringList& args, const Options&)
+{
+    const auto quest = loadQuestData(args[0]);
+    if (!quest)
+        return 1;
+
+    const auto serialized = Resources::QuestData::serialize(*quest);
+    return writeFile(args[1], { (const u8*)serialized.data(), (size_t)serialized.size() }) ? 0 : 1;
+}
+
+int Tool::dump(const QStringList& args, const Options&)
+{
+    const auto quest = loadQuestData(args[0]);
+    if (!quest)
+        return 1;
+
+    const auto json = QJsonDocument(Resources::questDataToJson(*quest)).toJson();
+    return writeFile(args[1], { (const u8*)json.data(), (size_t)json.size() }) ? 0 : 1;
+}
+
+int Tool::diff(const QStringList& args, const Options&)
+{
+    const auto a = loadQuestData(args[0]);
+    const auto b = loadQuestData(args[1]);
+    if (!a || !b)
+        return 1;
+
+    QTextStream out(stdout);
+    for (const auto& change : Resources::diffQuestData(*a, *b))
+        out << change << '\n';
+
+    return 0;
+}
+
+int Tool::check(const QStringList& args, const Options&)
+{
+    const auto quest = loadQuestData(args[0]);
+    if (!quest)
+        return 1;
+
+    const auto errors = Resources::validateQuestData(*quest);
+
+    QTextStream out(stdout);
+    for (const auto& error : errors)
+        out << error << '\n';
+
+    return errors.isEmpty() ? 0 : 1;
+}
+
+int Tool::bench(const QStringList& args, const Options&)
+{
+    const auto arc = loadArc(args[0]);
+    if (!arc)
+        return 1;
+
+    // Everything is decompressed up front so only the work being measured is timed
+    std::vector<Resources::PayloadView> payloads;
+    std::vector<Resources::PayloadView> gmds;
+    for (const auto& entry : arc->getEntries())
+    {
+        const auto data = arc->getDataView(entry);
+        if (data.empty() && entry.RealSize != 0)
+        {
+            qCritical("Failed to decompress %s", qUtf8Printable(entry.Path));
+            return 1;
+        }
+
+        if (entry.Extension == ".gmd")
+            gmds.push_back(data);
+
+        payloads.push_back(data);
+    }
+
+    QTextStream out(stdout);
+    benchCompression(out, payloads);
+
+    if (!benchLookup(out))
+        return 1;
+
+    benchGmdParse(out, gmds);
+
+    return 0;
+}
@@ -0,0 +1,28 @@
+#pragma once
+
+#include "Resources/Compression.h"
+
+#include <QStringList>
+
+
+namespace Tool
+{
+
+struct Options
+{
+    Resources::CompressionPolicy Compression;
+};
+
+// Every command takes its positional arguments and returns the process exit code
+int list(const QStringList& args, const Options& options);
+int unpack(const QStringList& args, const Options& options);
+int pack(const QStringList& args, const Options& options);
+int extract(const QStringList& args, const Options& options);
+int replace(const QStringList& args, const Options& options);
+int convert(const QStringList& args, const Options& options);
+int dump(const QStringList& args, const Options& options);
+int diff(const QStringList& args, const Options& options);
+int check(const QStringList& args, const Options& options);
+int bench(const QStringList& args, const Options& options);
+
+}
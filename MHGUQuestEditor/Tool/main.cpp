@@ -0,0 +1,99 @@
+#include "Commands.h"
+
+#include <QCommandLineParser>
+#include <QCoreApplication>
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+
+namespace
+{
+
+struct Command
+{
+    const char* Name;
+    const char* Arguments;
+    const char* Description;
+    int (*Run)(const QStringList& args, const Tool::Options& options);
+};
+
+constexpr std::array Commands = {
+    Command{ "list", "<arc>", "List all entries of an arc", &Tool::list },
+    Command{ "unpack", "<arc> <folder>", "Extract every entry of an arc into a folder", &Tool::unpack },
+    Command{ "pack", "<folder> <arc>", "Build an arc from a folder, in the order of its manifest if it has one", &Tool::pack },
+    Command{ "extract", "<arc> <entry> <file>", "Extract a single entry of an arc", &Tool::extract },
+    Command{ "replace", "<arc> <entry> <file>", "Replace the data of a single entry of an arc", &Tool::replace },
+    Command{ "convert", "<quest> <file>", "Write the quest data of a quest file or quest arc to a quest file", &Tool::convert },
+    Command{ "dump", "<quest> <file>", "Write the quest data of a quest file or quest arc as JSON", &Tool::dump },
+    Command{ "diff", "<quest> <quest>", "List the quest data fields that differ between two quests", &Tool::diff },
+    Command{ "check", "<quest>", "List the quest data fields with values the game does not know", &Tool::check },
+    Command{ "bench", "<arc>", "Measure compression per level and GMD parsing on the entries of an arc, and entry lookup in a large arc", &Tool::bench },
+};
+
+int countArguments(const char* arguments)
+{
+    return (int)std::count(arguments, arguments + std::strlen(arguments), '<');
+}
+
+}
+
+int main(int argc, char* argv[])
+{
+    QCoreApplication app(argc, argv);
+    QCoreApplication::setApplicationName("MHGUQuestTool");
+
+    QString description = "Command line access to MHGU quest resources.\n\nCommands:";
+    for (const auto& command : Commands)
+        description += QString("\n  %1 %2\n      %3").arg(command.Name, command.Arguments, command.Description);
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription(description);
+    parser.addHelpOption();
+    parser.addPositionalArgument("command", "The command to run.");
+    parser.addPositionalArgument("args", "Arguments of the command.", "[args...]");
+
+    const QCommandLineOption compressionOption(
+        "compression",
+        "How modified entries are compressed: stored, fast, default or best.",
+        "level",
+        "default"
+    );
+    parser.addOption(compressionOption);
+    parser.process(app);
+
+    auto args = parser.positionalArguments();
+    if (args.isEmpty())
+        parser.showHelp(1);
+
+    const auto name = args.takeFirst();
+    const auto command = std::ranges::find_if(Commands, [&name](const Command& c) { return name == c.Name; });
+    if (command == Commands.end())
+    {
+        qCritical("Unknown command %s", qUtf8Printable(name));
+        parser.showHelp(1);
+    }
+
+    if (args.size() != countArguments(command->Arguments))
+    {
+        qCritical("Usage: %s %s", command->Name, command->Arguments);
+        return 1;
+    }
+
+    using Preset = Resources::CompressionPolicy::Preset;
+    const std::array presets = { "stored", "fast", "default", "best" };
+
+    const auto compression = parser.value(compressionOption);
+    const auto preset = std::ranges::find(presets, compression);
+    if (preset == presets.end())
+    {
+        qCritical("Unknown compression %s", qUtf8Printable(compression));
+        return 1;
+    }
+
+    const Tool::Options options = {
+        .Compression = Resources::CompressionPolicy::fromPreset((Preset)(preset - presets.begin()))
+    };
+
+    return command->Run(args, options);
+}
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <Common.h>
+
+#include <bit>
+#include <cstring>
+#include <span>
+#include <type_traits>
+
+
+namespace Util
+{
+
+// Bounds-checked reader over little-endian data. A read that would run past the end reads
+// nothing and puts the reader into a failed state that sticks, similar to QDataStream::ReadPastEnd.
+class SpanReader
+{
+    static_assert(std::endian::native == std::endian::little, "Resources are read by copying little-endian data as is");
+
+public:
+    explicit SpanReader(std::span<const u8> data) : data(data) {}
+
+    template<typename T> requires std::is_trivially_copyable_v<T>
+    bool read(T& value)
+    {
+        const auto bytes = readBytes(sizeof(T));
+        if (bytes.empty())
+            return false;
+
+        std::memcpy(&value, bytes.data(), sizeof(T));
+        return true;
+    }
+
+    template<typename T> requires std::is_trivially_copyable_v<T>
+    T read()
+    {
+        T value{};
+        read(value);
+        return value;
+    }
+
+    // The returned view points into the underlying data, nothing is copied
+    std::span<const u8> readBytes(size_t size)
+    {
+        if (failed || size > data.size() - offset)
+        {
+            failed = true;
+            return {};
+        }
+
+        const auto bytes = data.subspan(offset, size);
+        offset += size;
+        return bytes;
+    }
+
+    bool skip(size_t size)
+    {
+        return readBytes(size).size() == size;
+    }
+
+    bool seek(size_t position)
+    {
+        if (failed || position > data.size())
+        {
+            failed = true;
+            return false;
+        }
+
+        offset = position;
+        return true;
+    }
+
+    size_t pos() const { return offset; }
+    size_t size() const { return data.size(); }
+    size_t remaining() const { return data.size() - offset; }
+    bool ok() const { return !failed; }
+
+private:
+    std::span<const u8> data;
+    size_t offset = 0;
+    bool failed = false;
+};
+
+}
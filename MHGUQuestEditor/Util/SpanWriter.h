@@ -0,0 +1,66 @@
+#pragma once
+
+#include <Common.h>
+
+#include <QByteArray>
+
+#include <bit>
+#include <cstring>
+#include <span>
+#include <type_traits>
+
+
+namespace Util
+{
+
+// Bounds-checked little-endian writer into a buffer sized up front, the counterpart of SpanReader.
+// Writes that do not fit write nothing and put the writer into a failed state that sticks.
+class SpanWriter
+{
+    static_assert(std::endian::native == std::endian::little, "Resources are written by copying little-endian data as is");
+
+public:
+    explicit SpanWriter(std::span<u8> data) : data(data) {}
+    explicit SpanWriter(QByteArray& data) : data((u8*)data.data(), (size_t)data.size()) {}
+
+    template<typename T> requires std::is_trivially_copyable_v<T>
+    bool write(const T& value)
+    {
+        return writeBytes({ (const u8*)&value, sizeof(T) });
+    }
+
+    bool writeBytes(std::span<const u8> bytes)
+    {
+        if (failed || bytes.size() > data.size() - offset)
+        {
+            failed = true;
+            return false;
+        }
+
+        std::memcpy(data.data() + offset, bytes.data(), bytes.size());
+        offset += bytes.size();
+        return true;
+    }
+
+    bool seek(size_t position)
+    {
+        if (failed || position > data.size())
+        {
+            failed = true;
+            return false;
+        }
+
+        offset = position;
+        return true;
+    }
+
+    size_t pos() const { return offset; }
+    bool ok() const { return !failed; }
+
+private:
+    std::span<u8> data;
+    size_t offset = 0;
+    bool failed = false;
+};
+
+}
@@ -14,6 +14,8 @@ class AcEquipEditor : public QWidget
 {
     Q_OBJECT
 
+    friend class EditorBench; // Times loadQuestData, see Bench/EditorBench.cpp
+
 public:
     AcEquipEditor(QWidget *parent = nullptr);
     ~AcEquipEditor() = default;
@@ -1,24 +1,28 @@
 #include "EquipSetEditor.h"
 #include "MHGUQuestEditor.h"
+#include "Models/EquipSetModels.h"
+#include "Models/ItemDelegates.h"
+#include "Models/LookupModel.h"
+#include "Resources/DataBundle.h"
 #include "Resources/Gmd.h"
 
 #include <QFile>
 #include <QIODevice>
-#include <QJsonDocument>
-#include <QJsonArray>
-#include <QJsonObject>
 
 #include <ranges>
 
 enum Roles {
     HunterArtIdRole = Qt::UserRole + 1,
 
-    ArmorIdRole = Qt::UserRole + 1,
-
     WeaponFamilyRole = Qt::UserRole + 1,
     WeaponLevelRole = Qt::UserRole + 2,
 };
 
+// Decoration combos hold the item id of the decoration as their data
+static int decorationId(const QComboBox* combo, int index)
+{
+    return index < 0 ? -1 : combo->itemData(index).toInt();
+}
 
 EquipSetEditor::EquipSetEditor(QWidget *parent)
     : QWidget(parent)
@@ -26,38 +30,26 @@ EquipSetEditor::EquipSetEditor(QWidget *parent)
 
     if (!HunterArtsModel)
     {
-        QFile hunterArtsFile(":/res/hunter_arts.json");
-        if (!hunterArtsFile.open(QIODevice::ReadOnly))
-        {
-            qFatal("Failed to open hunter_arts.json");
-        }
+        const auto& bundle = Resources::DataBundle::builtin();
 
         HunterArtsModel = new QStandardItemModel();
 
-        const auto hunterArts = QJsonDocument::fromJson(hunterArtsFile.readAll()).object();
-        for (const auto& key : hunterArts.keys())
+        const auto hunterArts = bundle.table("hunter_arts");
+        for (u32 i = 0; i < hunterArts.rows(); i++)
         {
-            const auto id = hunterArts[key].toInt();
-            const auto item = new QStandardItem(key);
-            item->setData(id, Roles::HunterArtIdRole);
+            const auto item = new QStandardItem(hunterArts.text(i, 0));
+            item->setData(hunterArts.integer(i, 1), Roles::HunterArtIdRole);
             HunterArtsModel->appendRow(item);
         }
 
-        QFile armorSeriesDataFile(":/res/armor_series_data.json");
         QFile armorNamesFile(":/res/armor_series_data.gmd");
-
-        if (!armorSeriesDataFile.open(QIODevice::ReadOnly))
-        {
-            qFatal("Failed to open armor_series_data.json");
-        }
-
         if (!armorNamesFile.open(QIODevice::ReadOnly))
         {
             qFatal("Failed to open armor_series_data.gmd");
         }
 
         const auto armorNames = Resources::Gmd::deserialize(armorNamesFile.readAll());
-        const auto armorSeriesData = QJsonDocument::fromJson(armorSeriesDataFile.readAll()).array();
+        const auto armorSeriesData = bundle.table("armor_series_data");
 
         // armor_series_data.gmd format is:
         // 0: Head Name
@@ -70,114 +62,88 @@ EquipSetEditor::EquipSetEditor(QWidget *parent)
         // 7: Arm Description
         // 8: Waist Description
         // 9: Leg Description
-        if (armorNames.Entries.size() / 10 != armorSeriesData.size())
+        if (armorNames.size() / 10 != armorSeriesData.rows())
         {
             qFatal("Armor names and armor series data do not match");
         }
 
-        HeadArmorModel = new QStandardItemModel();
-        ChestArmorModel = new QStandardItemModel();
-        ArmArmorModel = new QStandardItemModel();
-        WaistArmorModel = new QStandardItemModel();
-        LegArmorModel = new QStandardItemModel();
-
-        ArmorModels[0] = HeadArmorModel;
-        ArmorModels[1] = ChestArmorModel;
-        ArmorModels[2] = ArmArmorModel;
-        ArmorModels[3] = WaistArmorModel;
-        ArmorModels[4] = LegArmorModel;
+        std::array<std::vector<LookupModel::Entry>, 5> armorPieces;
 
         QFontMetrics fm(QFont("Segoe UI", 11));
 
-        for (const auto armor : armorSeriesData)
+        for (u32 row = 0; row < armorSeriesData.rows(); row++)
         {
-            const auto obj = armor.toObject();
-            const auto id = obj["Id"].toInt();
-            const auto maxLevel = obj["MaxLevel"].toInt();
+            const auto id = armorSeriesData.integer(row, 0);
+            const auto maxLevel = armorSeriesData.integer(row, 1);
 
             ArmorSeriesData.emplace_back(id, maxLevel);
 
-            const auto pieces = obj["Pieces"].toArray();
-            if (pieces[0].toInt()) {
-                const auto name = QString::fromStdString(armorNames.Entries[id * 10ull + 0]);
-                const auto item = new QStandardItem(name);
-                item->setData(id, Roles::ArmorIdRole);
-                HeadArmorModel->appendRow(item);
-                ArmorComboMinWidth = std::max(ArmorComboMinWidth, fm.horizontalAdvance(name) + 15);
-            }
-
-            if (pieces[1].toInt()) {
-                const auto name = QString::fromStdString(armorNames.Entries[id * 10ull + 1]);
-                const auto item = new QStandardItem(name);
-                item->setData(id, Roles::ArmorIdRole);
-                ChestArmorModel->appendRow(item);
-                ArmorComboMinWidth = std::max(ArmorComboMinWidth, fm.horizontalAdvance(name) + 15);
-            }
-
-            if (pieces[2].toInt()) {
-                const auto name = QString::fromStdString(armorNames.Entries[id * 10ull + 2]);
-                const auto item = new QStandardItem(name);
-                item->setData(id, Roles::ArmorIdRole);
-                ArmArmorModel->appendRow(item);
-                ArmorComboMinWidth = std::max(ArmorComboMinWidth, fm.horizontalAdvance(name) + 15);
-            }
+            // Whether the series has a head, chest, arm, waist and leg piece
+            for (u32 piece = 0; piece < armorPieces.size(); piece++)
+            {
+                if (!armorSeriesData.integer(row, 2 + piece))
+                    continue;
 
-            if (pieces[3].toInt()) {
-                const auto name = QString::fromStdString(armorNames.Entries[id * 10ull + 3]);
-                const auto item = new QStandardItem(name);
-                item->setData(id, Roles::ArmorIdRole);
-                WaistArmorModel->appendRow(item);
+                const auto name = armorNames.text(id * 10ull + piece);
+                armorPieces[piece].push_back({ name, id });
                 ArmorComboMinWidth = std::max(ArmorComboMinWidth, fm.horizontalAdvance(name) + 15);
             }
+        }
 
-            if (pieces[4].toInt()) {
-                const auto name = QString::fromStdString(armorNames.Entries[id * 10ull + 4]);
-                const auto item = new QStandardItem(name);
-                item->setData(id, Roles::ArmorIdRole);
-                LegArmorModel->appendRow(item);
-                ArmorComboMinWidth = std::max(ArmorComboMinWidth, fm.horizontalAdvance(name) + 15);
-            }
+        for (auto piece = 0; piece < armorPieces.size(); piece++)
+        {
+            ArmorModels[piece] = new LookupModel(std::move(armorPieces[piece]));
         }
 
         SkillNamesModel = new QStringListModel();
 
-        QFile skillNamesFile(":/res/skill_names.json");
-        if (!skillNamesFile.open(QIODevice::ReadOnly))
+        const auto skillNames = bundle.table("skill_names");
+        QStringList skillNameList;
+        skillNameList.reserve(skillNames.rows());
+        for (u32 i = 0; i < skillNames.rows(); i++)
         {
-            qFatal("Failed to open skill_names.json");
+            skillNameList.push_back(skillNames.text(i, 0));
         }
 
-        const auto skillNames = QJsonDocument::fromJson(skillNamesFile.readAll());
-        SkillNamesModel->setStringList(skillNames.toVariant().toStringList());
+        SkillNamesModel->setStringList(skillNameList);
 
-        QFile weaponFile(":/res/weapons.json");
-        if (!weaponFile.open(QIODevice::ReadOnly))
+        // Decorations are filtered out of the item list once and shared by every decoration combo
+        std::vector<LookupModel::Entry> decorations;
+        const auto itemNames = MHGUQuestEditor::ItemNamesModel;
+        for (int row = 0; row < itemNames->rowCount(); row++)
         {
-            qFatal("Failed to open weapons.json");
+            const auto& item = itemNames->entry(row);
+            if (item.Name.contains("Jwl", Qt::CaseInsensitive) || item.Name == "None")
+                decorations.push_back(item);
         }
 
+        DecorationsModel = new LookupModel(std::move(decorations));
+
         using Resources::AcEquip;
-        QJsonArray weapons = QJsonDocument::fromJson(weaponFile.readAll()).array();
+        const auto weaponTypes = bundle.table("weapon_types");
+        const auto weapons = bundle.table("weapons");
 
         for (const auto& [id, name] : AcEquip::WeaponTypes)
         {
             const auto weaponModel = new QStandardItemModel();
             WeaponModels[id] = weaponModel;
-            const auto weaponData = std::ranges::find_if(weapons, [&name](const auto weapon) {
-                return weapon.toObject()["Type"].toString() == name;
-            })->toObject()["Weapons"].toArray();
+
+            u32 type = 0;
+            while (type < weaponTypes.rows() && weaponTypes.text(type, 0) != name)
+                type++;
 
             const auto noneItem = new QStandardItem("None");
             noneItem->setData(0, Roles::WeaponFamilyRole);
             noneItem->setData(0, Roles::WeaponLevelRole);
             weaponModel->appendRow(noneItem);
 
-            for (const auto weaponRef : weaponData)
+            const auto first = (u32)weaponTypes.integer(type, 1);
+            const auto count = (u32)weaponTypes.integer(type, 2);
+            for (auto weapon = first; weapon < first + count; weapon++)
             {
-                const auto weapon = weaponRef.toObject();
-                const auto item = new QStandardItem(weapon["Name"].toString());
-                item->setData(weapon["Family"].toInt(), Roles::WeaponFamilyRole);
-                item->setData(weapon["Level"].toInt(), Roles::WeaponLevelRole);
+                const auto item = new QStandardItem(weapons.text(weapon, 0));
+                item->setData(weapons.integer(weapon, 1), Roles::WeaponFamilyRole);
+                item->setData(weapons.integer(weapon, 2), Roles::WeaponLevelRole);
                 weaponModel->appendRow(item);
             }
         }
@@ -185,13 +151,13 @@ EquipSetEditor::EquipSetEditor(QWidget *parent)
 
     ui.setupUi(this);
 
-    ui.comboWeaponDeco1->setModel(new DecorationSortFilterProxyModel(MHGUQuestEditor::ItemNamesModel));
-    ui.comboWeaponDeco2->setModel(new DecorationSortFilterProxyModel(MHGUQuestEditor::ItemNamesModel));
-    ui.comboWeaponDeco3->setModel(new DecorationSortFilterProxyModel(MHGUQuestEditor::ItemNamesModel));
+    ui.comboWeaponDeco1->setModel(DecorationsModel);
+    ui.comboWeaponDeco2->setModel(DecorationsModel);
+    ui.comboWeaponDeco3->setModel(DecorationsModel);
 
-    ui.comboCharmDeco1->setModel(new DecorationSortFilterProxyModel(MHGUQuestEditor::ItemNamesModel));
-    ui.comboCharmDeco2->setModel(new DecorationSortFilterProxyModel(MHGUQuestEditor::ItemNamesModel));
-    ui.comboCharmDeco3->setModel(new DecorationSortFilterProxyModel(MHGUQuestEditor::ItemNamesModel));
+    ui.comboCharmDeco1->setModel(DecorationsModel);
+    ui.comboCharmDeco2->setModel(DecorationsModel);
+    ui.comboCharmDeco3->setModel(DecorationsModel);
 
     ui.comboCharmDeco1->view()->setMinimumWidth(190);
     ui.comboCharmDeco2->view()->setMinimumWidth(190);
@@ -215,72 +181,33 @@ EquipSetEditor::EquipSetEditor(QWidget *parent)
     ui.comboCharmSkill1->setModel(SkillNamesModel);
     ui.comboCharmSkill2->setModel(SkillNamesModel);
 
-    static constexpr std::array armorPieces = {
-        "Head",
-        "Chest",
-        "Arms",
-        "Waist",
-        "Legs"
-    };
-
-    for (int i = 0; i < armorPieces.size(); ++i)
-    {
-        ui.tableWidgetArmor->insertRow(i);
-
-        ui.tableWidgetArmor->setCellWidget(i, 0, new QLabel(armorPieces[i]));
-
-        const auto& armorSeries = ArmorSeriesData[0];
-
-        const auto armorCombo = new QComboBox(ui.tableWidgetArmor);
-        armorCombo->setModel(ArmorModels[i]);
-        armorCombo->setCurrentIndex(armorCombo->findData(0));
-        armorCombo->view()->setMinimumWidth(ArmorComboMinWidth);
-
-        ui.tableWidgetArmor->setCellWidget(i, 1, armorCombo);
-
-        const auto levelBox = new QSpinBox(ui.tableWidgetArmor);
-        levelBox->setRange(1, armorSeries.MaxLevel);
-        levelBox->setValue(1);
-
-        ui.tableWidgetArmor->setCellWidget(i, 2, levelBox);
-
-        const auto deco1Combo = new QComboBox(ui.tableWidgetArmor);
-        const auto deco2Combo = new QComboBox(ui.tableWidgetArmor);
-        const auto deco3Combo = new QComboBox(ui.tableWidgetArmor);
-
-        deco1Combo->setModel(new DecorationSortFilterProxyModel(MHGUQuestEditor::ItemNamesModel));
-        deco2Combo->setModel(new DecorationSortFilterProxyModel(MHGUQuestEditor::ItemNamesModel));
-        deco3Combo->setModel(new DecorationSortFilterProxyModel(MHGUQuestEditor::ItemNamesModel));
-
-        deco1Combo->setCurrentIndex(0);
-        deco2Combo->setCurrentIndex(0);
-        deco3Combo->setCurrentIndex(0);
-
-        deco1Combo->view()->setMinimumWidth(190);
-        deco2Combo->view()->setMinimumWidth(190);
-        deco3Combo->view()->setMinimumWidth(190);
-
-        ui.tableWidgetArmor->setCellWidget(i, 3, deco1Combo);
-        ui.tableWidgetArmor->setCellWidget(i, 4, deco2Combo);
-        ui.tableWidgetArmor->setCellWidget(i, 5, deco3Combo);
-    }
-
-    for (int i = 0; i < std::size(Resources::EquipSet{}.Items); ++i)
-    {
-        ui.tableWidgetItems->insertRow(i);
-
-        const auto itemCombo = new QComboBox(ui.tableWidgetItems);
-        itemCombo->setModel(MHGUQuestEditor::ItemNamesModel);
-        itemCombo->setCurrentIndex(0);
-        itemCombo->setMinimumWidth(190);
-        itemCombo->view()->setMinimumWidth(190);
-        ui.tableWidgetItems->setCellWidget(i, 0, itemCombo);
-
-        const auto countBox = new QSpinBox(ui.tableWidgetItems);
-        countBox->setRange(0, 99);
-        countBox->setValue(0);
-        ui.tableWidgetItems->setCellWidget(i, 1, countBox);
-    }
+    // Only the cell being edited gets an editor widget, everything else is painted from the models
+    armorModel = new ArmorTableModel(ArmorModels, DecorationsModel, [](int armorId) {
+        return armorId < ArmorSeriesData.size() ? ArmorSeriesData[armorId].MaxLevel : 1;
+    }, this);
+    itemModel = new EquipItemTableModel(MHGUQuestEditor::ItemNamesModel, this);
+
+    ui.tableViewArmor->setModel(armorModel);
+    ui.tableViewArmor->setEditTriggers(QAbstractItemView::AllEditTriggers);
+    ui.tableViewArmor->setItemDelegateForColumn(ArmorTableModel::Armor, new LookupDelegate([this](const QModelIndex& index) {
+        return armorModel->armorNames(index.row());
+    }, ArmorComboMinWidth, this));
+    ui.tableViewArmor->setItemDelegateForColumn(ArmorTableModel::Level, new SpinBoxDelegate(1, [this](const QModelIndex& index) {
+        return armorModel->maxLevel(index.row());
+    }, this));
+
+    const auto decorationDelegate = new LookupDelegate([](const QModelIndex&) { return DecorationsModel; }, 190, this);
+    ui.tableViewArmor->setItemDelegateForColumn(ArmorTableModel::Deco1, decorationDelegate);
+    ui.tableViewArmor->setItemDelegateForColumn(ArmorTableModel::Deco2, decorationDelegate);
+    ui.tableViewArmor->setItemDelegateForColumn(ArmorTableModel::Deco3, decorationDelegate);
+
+    ui.tableViewItems->setModel(itemModel);
+    ui.tableViewItems->setEditTriggers(QAbstractItemView::AllEditTriggers);
+    ui.tableViewItems->setColumnWidth(EquipItemTableModel::Item, 190);
+    ui.tableViewItems->setItemDelegateForColumn(EquipItemTableModel::Item, new LookupDelegate([](const QModelIndex&) {
+        return MHGUQuestEditor::ItemNamesModel;
+    }, 190, this));
+    ui.tableViewItems->setItemDelegateForColumn(EquipItemTableModel::Count, new SpinBoxDelegate(0, 99, this));
 
     connect(ui.comboWeaponType, &QComboBox::currentIndexChanged, this, [this](int) {
         const auto type = ui.comboWeaponType->currentData().toInt();
@@ -313,16 +240,13 @@ EquipSetEditor::EquipSetEditor(QWidget *parent)
         if (equipSet) equipSet->HunterArts[2] = ui.comboHunterArt3->model()->index(index, 0).data(Roles::HunterArtIdRole).toInt();
     });
     connect(ui.comboWeaponDeco1, &QComboBox::currentIndexChanged, this, [this](int index) {
-        const auto model = qobject_cast<const DecorationSortFilterProxyModel*>(ui.comboWeaponDeco1->model());
-        if (equipSet) equipSet->WeaponDecos[0] = model->mapToSource(model->index(index, 0)).row();
+        if (equipSet) equipSet->WeaponDecos[0] = decorationId(ui.comboWeaponDeco1, index);
     });
     connect(ui.comboWeaponDeco2, &QComboBox::currentIndexChanged, this, [this](int index) {
-        const auto model = qobject_cast<const DecorationSortFilterProxyModel*>(ui.comboWeaponDeco2->model());
-        if (equipSet) equipSet->WeaponDecos[1] = model->mapToSource(model->index(index, 0)).row();
+        if (equipSet) equipSet->WeaponDecos[1] = decorationId(ui.comboWeaponDeco2, index);
     });
     connect(ui.comboWeaponDeco3, &QComboBox::currentIndexChanged, this, [this](int index) {
-        const auto model = qobject_cast<const DecorationSortFilterProxyModel*>(ui.comboWeaponDeco3->model());
-        if (equipSet) equipSet->WeaponDecos[2] = model->mapToSource(model->index(index, 0)).row();
+        if (equipSet) equipSet->WeaponDecos[2] = decorationId(ui.comboWeaponDeco3, index);
     });
     connect(ui.comboCharmSkill1, &QComboBox::currentIndexChanged, this, [this](int index) {
         if (equipSet) equipSet->CharmSkill1 = index;
@@ -337,87 +261,31 @@ EquipSetEditor::EquipSetEditor(QWidget *parent)
         if (equipSet) equipSet->CharmSkill2Level = value;
     });
     connect(ui.comboCharmDeco1, &QComboBox::currentIndexChanged, this, [this](int index) {
-        const auto model = qobject_cast<const DecorationSortFilterProxyModel*>(ui.comboCharmDeco1->model());
-        if (equipSet) equipSet->Equipment[5].Decos[0] = model->mapToSource(model->index(index, 0)).row();
+        if (equipSet) equipSet->Equipment[5].Decos[0] = decorationId(ui.comboCharmDeco1, index);
     });
     connect(ui.comboCharmDeco2, &QComboBox::currentIndexChanged, this, [this](int index) {
-        const auto model = qobject_cast<const DecorationSortFilterProxyModel*>(ui.comboCharmDeco2->model());
-        if (equipSet) equipSet->Equipment[5].Decos[1] = model->mapToSource(model->index(index, 0)).row();
+        if (equipSet) equipSet->Equipment[5].Decos[1] = decorationId(ui.comboCharmDeco2, index);
     });
     connect(ui.comboCharmDeco3, &QComboBox::currentIndexChanged, this, [this](int index) {
-        const auto model = qobject_cast<const DecorationSortFilterProxyModel*>(ui.comboCharmDeco3->model());
-        if (equipSet) equipSet->Equipment[5].Decos[2] = model->mapToSource(model->index(index, 0)).row();
+        if (equipSet) equipSet->Equipment[5].Decos[2] = decorationId(ui.comboCharmDeco3, index);
     });
-
-    for (int i = 0; i < std::size(Resources::EquipSet{}.Equipment) - 1; ++i)
-    {
-        const auto armorCombo = qobject_cast<QComboBox*>(ui.tableWidgetArmor->cellWidget(i, 1));
-        connect(armorCombo, &QComboBox::currentIndexChanged, this, [this, i, armorCombo](int index) {
-            if (equipSet)
-            {
-                const auto model = qobject_cast<const QStandardItemModel*>(armorCombo->model());
-                const auto idx = model->index(index, 0);
-                equipSet->Equipment[i].Id = idx.data(Roles::ArmorIdRole).toInt();
-
-                const auto maxLevel = ArmorSeriesData[equipSet->Equipment[i].Id].MaxLevel;
-                qobject_cast<QSpinBox*>(ui.tableWidgetArmor->cellWidget(i, 2))->setRange(1, maxLevel);
-            }
-        });
-
-        const auto levelBox = qobject_cast<QSpinBox*>(ui.tableWidgetArmor->cellWidget(i, 2));
-        connect(levelBox, QOverload<int>::of(&QSpinBox::valueChanged), this, [this, i](int value) {
-            if (equipSet) equipSet->Equipment[i].Level = value;
-        });
-
-        const auto deco1Combo = qobject_cast<QComboBox*>(ui.tableWidgetArmor->cellWidget(i, 3));
-        connect(deco1Combo, &QComboBox::currentIndexChanged, this, [this, i, deco1Combo](int index) {
-            const auto model = qobject_cast<const DecorationSortFilterProxyModel*>(deco1Combo->model());
-            if (equipSet) equipSet->Equipment[i].Decos[0] = model->mapToSource(model->index(index, 0)).row();
-        });
-
-        const auto deco2Combo = qobject_cast<QComboBox*>(ui.tableWidgetArmor->cellWidget(i, 4));
-        connect(deco2Combo, &QComboBox::currentIndexChanged, this, [this, i, deco2Combo](int index) {
-            const auto model = qobject_cast<const DecorationSortFilterProxyModel*>(deco2Combo->model());
-            if (equipSet) equipSet->Equipment[i].Decos[1] = model->mapToSource(model->index(index, 0)).row();
-        });
-
-        const auto deco3Combo = qobject_cast<QComboBox*>(ui.tableWidgetArmor->cellWidget(i, 5));
-        connect(deco3Combo, &QComboBox::currentIndexChanged, this, [this, i, deco3Combo](int index) {
-            const auto model = qobject_cast<const DecorationSortFilterProxyModel*>(deco3Combo->model());
-            if (equipSet) equipSet->Equipment[i].Decos[2] = model->mapToSource(model->index(index, 0)).row();
-        });
-    }
-
-    for (int i = 0; i < std::size(Resources::EquipSet{}.Items); ++i)
-    {
-        const auto itemCombo = qobject_cast<QComboBox*>(ui.tableWidgetItems->cellWidget(i, 0));
-        connect(itemCombo, &QComboBox::currentIndexChanged, this, [this, i, itemCombo](int index) {
-            if (equipSet) equipSet->Items[i].Id = index;
-        });
-        const auto countBox = qobject_cast<QSpinBox*>(ui.tableWidgetItems->cellWidget(i, 1));
-        connect(countBox, QOverload<int>::of(&QSpinBox::valueChanged), this, [this, i](int value) {
-            if (equipSet) equipSet->Items[i].Count = value;
-        });
-    }
 }
 
 void EquipSetEditor::loadEquipSet()
 {
+    armorModel->setEquipSet(equipSet);
+    itemModel->setEquipSet(equipSet);
+
     if (!equipSet)
         return;
 
     Resources::EquipSet before = *equipSet;
 
-    const auto decoIdToIndex = [](const QAbstractItemModel* model, int id) {
-        const auto decoModel = qobject_cast<const DecorationSortFilterProxyModel*>(model);
-        return decoModel->mapFromSource(decoModel->sourceModel()->index(id, 0)).row();
-    };
-
     const auto findItemIndex = [](const QComboBox* combo, int id) {
         const auto model = qobject_cast<const QStandardItemModel*>(combo->model());
         for (auto i = 0; i < model->rowCount(); ++i)
         {
-            if (model->index(i, 0).data(Roles::ArmorIdRole).toInt() == id)
+            if (model->index(i, 0).data(Roles::HunterArtIdRole).toInt() == id)
             {
                 return i;
             }
@@ -448,47 +316,16 @@ void EquipSetEditor::loadEquipSet()
     ui.comboHunterArt1->setCurrentIndex(findItemIndex(ui.comboHunterArt1, equipSet->HunterArts[0]));
     ui.comboHunterArt2->setCurrentIndex(findItemIndex(ui.comboHunterArt2, equipSet->HunterArts[1]));
     ui.comboHunterArt3->setCurrentIndex(findItemIndex(ui.comboHunterArt3, equipSet->HunterArts[2]));
-    ui.comboWeaponDeco1->setCurrentIndex(decoIdToIndex(ui.comboWeaponDeco1->model(), equipSet->WeaponDecos[0]));
-    ui.comboWeaponDeco2->setCurrentIndex(decoIdToIndex(ui.comboWeaponDeco2->model(), equipSet->WeaponDecos[1]));
-    ui.comboWeaponDeco3->setCurrentIndex(decoIdToIndex(ui.comboWeaponDeco3->model(), equipSet->WeaponDecos[2]));
+    ui.comboWeaponDeco1->setCurrentIndex(ui.comboWeaponDeco1->findData(equipSet->WeaponDecos[0]));
+    ui.comboWeaponDeco2->setCurrentIndex(ui.comboWeaponDeco2->findData(equipSet->WeaponDecos[1]));
+    ui.comboWeaponDeco3->setCurrentIndex(ui.comboWeaponDeco3->findData(equipSet->WeaponDecos[2]));
     ui.comboCharmSkill1->setCurrentIndex(equipSet->CharmSkill1);
     ui.comboCharmSkill2->setCurrentIndex(equipSet->CharmSkill2);
     ui.spinBoxCharmSkil1Level->setValue(equipSet->CharmSkill1Level);
     ui.spinBoxCharmSkil2Level->setValue(equipSet->CharmSkill2Level);
-    ui.comboCharmDeco1->setCurrentIndex(decoIdToIndex(ui.comboCharmDeco1->model(), equipSet->Equipment[5].Decos[0]));
-    ui.comboCharmDeco2->setCurrentIndex(decoIdToIndex(ui.comboCharmDeco2->model(), equipSet->Equipment[5].Decos[1]));
-    ui.comboCharmDeco3->setCurrentIndex(decoIdToIndex(ui.comboCharmDeco3->model(), equipSet->Equipment[5].Decos[2]));
-
-    for (int i = 0; i < std::size(equipSet->Equipment) - 1; ++i)
-    {
-        const auto& equipment = equipSet->Equipment[i];
-
-        const auto armorCombo = qobject_cast<QComboBox*>(ui.tableWidgetArmor->cellWidget(i, 1));
-        armorCombo->setCurrentIndex(findItemIndex(armorCombo, equipment.Id));
-
-        const auto levelBox = qobject_cast<QSpinBox*>(ui.tableWidgetArmor->cellWidget(i, 2));
-        levelBox->setValue(equipment.Level);
-
-        const auto deco1Combo = qobject_cast<QComboBox*>(ui.tableWidgetArmor->cellWidget(i, 3));
-        deco1Combo->setCurrentIndex(decoIdToIndex(deco1Combo->model(), equipment.Decos[0]));
-
-        const auto deco2Combo = qobject_cast<QComboBox*>(ui.tableWidgetArmor->cellWidget(i, 4));
-        deco2Combo->setCurrentIndex(decoIdToIndex(deco2Combo->model(), equipment.Decos[1]));
-
-        const auto deco3Combo = qobject_cast<QComboBox*>(ui.tableWidgetArmor->cellWidget(i, 5));
-        deco3Combo->setCurrentIndex(decoIdToIndex(deco3Combo->model(), equipment.Decos[2]));
-    }
-
-    for (int i = 0; i < std::size(equipSet->Items); ++i)
-    {
-        const auto& item = equipSet->Items[i];
-
-        const auto itemCombo = qobject_cast<QComboBox*>(ui.tableWidgetItems->cellWidget(i, 0));
-        itemCombo->setCurrentIndex(item.Id);
-
-        const auto countBox = qobject_cast<QSpinBox*>(ui.tableWidgetItems->cellWidget(i, 1));
-        countBox->setValue(item.Count);
-    }
+    ui.comboCharmDeco1->setCurrentIndex(ui.comboCharmDeco1->findData(equipSet->Equipment[5].Decos[0]));
+    ui.comboCharmDeco2->setCurrentIndex(ui.comboCharmDeco2->findData(equipSet->Equipment[5].Decos[1]));
+    ui.comboCharmDeco3->setCurrentIndex(ui.comboCharmDeco3->findData(equipSet->Equipment[5].Decos[2]));
 
     ui.comboWeaponType->blockSignals(false);
     ui.comboWeapon->blockSignals(false);
@@ -1,7 +1,6 @@
 #pragma once
 
 #include <QWidget>
-#include <QSortFilterProxyModel>
 #include <QStringListModel>
 #include <QStandardItemModel>
 
@@ -19,24 +18,9 @@ struct WeaponData {
     int Level;
 };
 
-class DecorationSortFilterProxyModel : public QSortFilterProxyModel
-{
-    Q_OBJECT
-
-public:
-    explicit DecorationSortFilterProxyModel(QStringListModel* sourceModel, QObject* parent = nullptr)
-        : QSortFilterProxyModel(parent) {
-        QSortFilterProxyModel::setSourceModel(sourceModel);
-    }
-
-protected:
-    bool filterAcceptsRow(int source_row, const QModelIndex& source_parent) const override
-    {
-        const auto itemText = sourceModel()->index(source_row, 0, source_parent).data().toString();
-
-        return itemText.contains("Jwl", Qt::CaseInsensitive) || itemText == "None";
-    }
-};
+class ArmorTableModel;
+class EquipItemTableModel;
+class LookupModel;
 
 class EquipSetEditor : public QWidget
 {
@@ -57,17 +41,15 @@ private:
 private:
     Ui::EquipSetEditorClass ui;
 
-    Resources::EquipSet* equipSet;
+    Resources::EquipSet* equipSet = nullptr;
+    ArmorTableModel* armorModel;
+    EquipItemTableModel* itemModel;
 
     static inline std::vector<ArmorData> ArmorSeriesData;
     static inline QStandardItemModel* HunterArtsModel;
-    static inline QStandardItemModel* HeadArmorModel;
-    static inline QStandardItemModel* ChestArmorModel;
-    static inline QStandardItemModel* ArmArmorModel;
-    static inline QStandardItemModel* WaistArmorModel;
-    static inline QStandardItemModel* LegArmorModel;
     static inline QStringListModel* SkillNamesModel;
+    static inline LookupModel* DecorationsModel;
     static inline int ArmorComboMinWidth = 0;
-    static inline std::array<QStandardItemModel*, 5> ArmorModels;
+    static inline std::array<LookupModel*, 5> ArmorModels;
     static inline std::map<int, QStandardItemModel*> WeaponModels;
 };
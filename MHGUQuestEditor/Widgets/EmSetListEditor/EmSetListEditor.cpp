@@ -1,15 +1,18 @@
 #include "EmSetListEditor.h"
+#include "Models/LookupModel.h"
+#include "Resources/DataBundle.h"
 
+#include <QApplication>
 #include <QFile>
 #include <QFileDialog>
-#include <QJsonDocument>
-#include <QJsonObject>
 #include <QMenu>
+#include <QSignalBlocker>
 #include <QTreeWidget>
 #include <utility>
 #include <ranges>
 
 std::unordered_map<int, QString> EmSetListEditor::monsterNames;
+LookupModel* EmSetListEditor::monsterModel = nullptr;
 
 enum ItemType
 {
@@ -31,23 +34,14 @@ EmSetListEditor::EmSetListEditor(Resources::EmSetList esl, QWidget *parent)
 
     if (monsterNames.empty())
     {
-        auto emsNames = QFile(":/res/ems_names.json");
-        if (!emsNames.open(QIODevice::ReadOnly))
+        const auto names = Resources::DataBundle::builtin().table("ems_names");
+        for (u32 i = 0; i < names.rows(); i++)
         {
-            qFatal("Failed to open ems_names.json");
-        }
-
-        QJsonObject names = QJsonDocument::fromJson(emsNames.readAll()).object();
-        for (const auto& name : names.keys())
-        {
-            monsterNames[names[name].toInt()] = name;
+            monsterNames[names.integer(i, 1)] = names.text(i, 0);
         }
     }
 
-    for (const auto& [id, name] : monsterNames)
-    {
-        ui.comboMonster->addItem(name, id);
-    }
+    // The monster dropdown is filled in by showEvent, the small monster tabs are hidden at startup
 
 #define CONNECT_SPINBOX(name, type, field, valtype, ...) \
     connect(ui.name, &type::valueChanged, this, [this](valtype _value) { \
@@ -189,6 +183,22 @@ EmSetListEditor::EmSetListEditor(Resources::EmSetList esl, QWidget *parent)
     });
 }
 
+void EmSetListEditor::showEvent(QShowEvent* event)
+{
+    if (ui.comboMonster->model() != monsterModel)
+    {
+        // Shared by every small monster editor, its value index makes findData a lookup
+        if (!monsterModel)
+            monsterModel = LookupModel::fromTable(Resources::DataBundle::builtin().table("ems_names"), qApp);
+
+        // Nothing is selected yet, so there is no ems the index change could write to
+        const QSignalBlocker blocker(ui.comboMonster);
+        ui.comboMonster->setModel(monsterModel);
+    }
+
+    QWidget::showEvent(event);
+}
+
 void EmSetListEditor::loadEmsIntoUi(const Resources::Ems& ems) const
 {
     ui.comboMonster->setCurrentIndex(ui.comboMonster->findData(ems.MonsterId));
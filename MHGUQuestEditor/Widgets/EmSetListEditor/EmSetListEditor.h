@@ -7,6 +7,8 @@
 #include <memory>
 #include <unordered_map>
 
+class LookupModel;
+
 
 class EmSetListEditor final : public QWidget
 {
@@ -22,6 +24,9 @@ public:
     }
     [[nodiscard]] const Resources::EmSetList& getEsl() const { return esl; }
 
+protected:
+    void showEvent(QShowEvent* event) override;
+
 private:
     void loadEmsIntoUi(const Resources::Ems& ems) const;
     Resources::Ems saveEmsFromUi() const;
@@ -38,4 +43,5 @@ private:
     Resources::Ems copiedEms;
 
     static std::unordered_map<int, QString> monsterNames;
+    static LookupModel* monsterModel;
 };